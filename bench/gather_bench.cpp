@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include "lib/gather.hpp"
+
+template<typename Func>
+double measure(size_t repeats, Func&& func) {
+    double best = 0;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (r == 0 || elapsed.count() < best) {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+void report(const char* name, size_t count, double naive, double tuned) {
+    std::cout << name << ": naive " << naive * 1e9 / count << " ns/elem, library "
+              << tuned * 1e9 / count << " ns/elem, speed-up " << naive / tuned << "x\n";
+}
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(1) << 24;
+    const size_t distance = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : default_prefetch_distance;
+    const size_t repeats = 3;
+
+    std::mt19937_64 gen(42);
+    Vector<uint64_t> table;
+    table.append_n(count, [](size_t i) { return i * 2654435761u; });
+    Vector<uint32_t> indices;
+    indices.append_n(count, [&] { return static_cast<uint32_t>(gen() % count); });
+    Vector<uint64_t> out;
+    out.resize_for_overwrite(count);
+
+    double naive = measure(repeats, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = table[indices[i]];
+        }
+    });
+    double tuned = measure(repeats, [&] { gather(table, indices, out, distance); });
+    report("gather", count, naive, tuned);
+
+    naive = measure(repeats, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            out[indices[i]] = table[i];
+        }
+    });
+    tuned = measure(repeats, [&] { scatter(table, indices, out, distance); });
+    report("scatter", count, naive, tuned);
+
+    Vector<uint32_t> perm;
+    perm.append_n(count, [](size_t i) { return static_cast<uint32_t>(i); });
+    std::shuffle(perm.begin(), perm.end(), gen);
+    Vector<uint64_t> scratch;
+    naive = measure(repeats, [&] {
+        scratch.resize_for_overwrite(count);
+        for (size_t i = 0; i < count; ++i) {
+            scratch[i] = table[perm[i]];
+        }
+        table.swap(scratch);
+    });
+    tuned = measure(repeats, [&] { apply_permutation(table, perm, scratch); });
+    report("permute", count, naive, tuned);
+    tuned = measure(repeats, [&] { apply_permutation(table, perm); });
+    report("permute in place", count, naive, tuned);
+}
@@ -0,0 +1,181 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "lib/vector.hpp"
+#include "perf_counters.hpp"
+
+struct BenchResult {
+    std::string operation;
+    std::string container;
+    size_t elements;
+    CounterSample sample;
+};
+
+volatile uint64_t sink;
+
+template<typename Setup, typename Body>
+CounterSample run(PerfCounters& counters, size_t repeats, Setup&& setup, Body&& body) {
+    CounterSample best;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto state = setup();
+        counters.start();
+        body(state);
+        CounterSample sample = counters.stop();
+        if (r == 0 || sample.wall_ns < best.wall_ns) {
+            best = sample;
+        }
+    }
+    return best;
+}
+
+void grow(Vector<uint64_t>& vec) {
+    vec.allocate();
+}
+
+void grow(std::vector<uint64_t>& vec) {
+    vec.reserve(vec.capacity() * 2);
+}
+
+template<typename Container>
+void bench_container(const char* name, size_t count, size_t repeats, PerfCounters& counters,
+                     std::vector<BenchResult>& results) {
+    auto empty = [] { return Container(); };
+    auto filled = [count] {
+        Container vec;
+        for (size_t i = 0; i < count; ++i) {
+            vec.push_back(i);
+        }
+        return vec;
+    };
+
+    results.push_back({"push_back", name, count, run(counters, repeats, empty, [count](Container& vec) {
+        for (size_t i = 0; i < count; ++i) {
+            vec.push_back(i);
+        }
+    })});
+    results.push_back({"emplace_back", name, count, run(counters, repeats, empty, [count](Container& vec) {
+        for (size_t i = 0; i < count; ++i) {
+            vec.emplace_back(i);
+        }
+    })});
+    results.push_back({"allocate", name, count, run(counters, repeats, filled, [](Container& vec) {
+        grow(vec);
+    })});
+    results.push_back({"iterate", name, count, run(counters, repeats, filled, [](Container& vec) {
+        uint64_t total = 0;
+        for (uint64_t value : vec) {
+            total += value;
+        }
+        sink = total;
+    })});
+    results.push_back({"index", name, count, run(counters, repeats, filled, [count](Container& vec) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += vec[i];
+        }
+        sink = total;
+    })});
+    results.push_back({"copy", name, count, run(counters, repeats, filled, [](Container& vec) {
+        Container copy(vec);
+        sink = copy.size();
+    })});
+}
+
+void print_table(const std::vector<BenchResult>& results, const PerfCounters& counters) {
+    std::cout << std::left << std::setw(14) << "operation" << std::setw(14) << "container"
+              << std::right << std::setw(12) << "ns/elem";
+    for (size_t i = 0; i < counter_count; ++i) {
+        if (counters.available(i)) {
+            std::cout << std::setw(15) << counter_specs[i].name;
+        }
+    }
+    std::cout << '\n' << std::fixed << std::setprecision(4);
+    for (const auto& result : results) {
+        std::cout << std::left << std::setw(14) << result.operation << std::setw(14) << result.container
+                  << std::right << std::setw(12) << result.sample.wall_ns / result.elements;
+        for (size_t i = 0; i < counter_count; ++i) {
+            if (!counters.available(i)) {
+                continue;
+            }
+            if (result.sample.valid[i]) {
+                std::cout << std::setw(15) << result.sample.values[i] / result.elements;
+            } else {
+                std::cout << std::setw(15) << "n/a";
+            }
+        }
+        std::cout << '\n';
+    }
+}
+
+void write_csv(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "cannot open " << path << '\n';
+        return;
+    }
+    out << "operation,container,elements,ns_per_elem";
+    for (const auto& spec : counter_specs) {
+        out << ',' << spec.name << "_per_elem";
+    }
+    out << '\n';
+    for (const auto& result : results) {
+        out << result.operation << ',' << result.container << ',' << result.elements << ','
+            << result.sample.wall_ns / result.elements;
+        for (size_t i = 0; i < counter_count; ++i) {
+            out << ',';
+            if (result.sample.valid[i]) {
+                out << result.sample.values[i] / result.elements;
+            }
+        }
+        out << '\n';
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t count = size_t(1) << 20;
+    size_t repeats = 5;
+    std::string csv;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--size") && i + 1 < argc) {
+            count = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--repeat") && i + 1 < argc) {
+            repeats = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--csv") && i + 1 < argc) {
+            csv = argv[++i];
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--size N] [--repeat R] [--csv FILE]\n";
+            return 1;
+        }
+    }
+    if (count == 0 || repeats == 0) {
+        std::cerr << "size and repeat must be positive\n";
+        return 1;
+    }
+
+    PerfCounters counters;
+    if (counters.available_count() == 0) {
+        std::cerr << "perf counters unavailable, reporting wall-clock time only\n";
+    } else if (counters.available_count() < counter_count) {
+        std::cerr << "unavailable counters:";
+        for (size_t i = 0; i < counter_count; ++i) {
+            if (!counters.available(i)) {
+                std::cerr << ' ' << counter_specs[i].name;
+            }
+        }
+        std::cerr << '\n';
+    }
+
+    std::vector<BenchResult> results;
+    bench_container<Vector<uint64_t>>("Vector", count, repeats, counters, results);
+    bench_container<std::vector<uint64_t>>("std::vector", count, repeats, counters, results);
+
+    print_table(results, counters);
+    if (!csv.empty()) {
+        write_csv(csv, results);
+    }
+}
@@ -0,0 +1,138 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#pragma once
+
+struct CounterSpec {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+#ifdef __linux__
+inline constexpr uint64_t cache_event(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+inline constexpr std::array<CounterSpec, 8> counter_specs = {{
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"l1d_misses", PERF_TYPE_HW_CACHE,
+        cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"dtlb_misses", PERF_TYPE_HW_CACHE,
+        cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    {"task_clock_ns", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+}};
+#else
+inline constexpr std::array<CounterSpec, 8> counter_specs = {{
+    {"cycles", 0, 0}, {"instructions", 0, 0}, {"l1d_misses", 0, 0}, {"llc_misses", 0, 0},
+    {"branch_misses", 0, 0}, {"dtlb_misses", 0, 0}, {"page_faults", 0, 0}, {"task_clock_ns", 0, 0},
+}};
+#endif
+
+inline constexpr size_t counter_count = counter_specs.size();
+
+struct CounterSample {
+    double wall_ns = 0;
+    std::array<double, counter_count> values{};
+    std::array<bool, counter_count> valid{};
+};
+
+class PerfCounters {
+    std::array<int, counter_count> fds_;
+    std::chrono::steady_clock::time_point start_;
+
+#ifdef __linux__
+    static int open_counter(const CounterSpec& spec) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = spec.type;
+        attr.config = spec.config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+public:
+    PerfCounters() {
+        fds_.fill(-1);
+#ifdef __linux__
+        for (size_t i = 0; i < counter_count; ++i) {
+            fds_[i] = open_counter(counter_specs[i]);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    bool available(size_t index) const noexcept {
+        return fds_[index] >= 0;
+    }
+
+    size_t available_count() const noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < counter_count; ++i) {
+            count += available(i);
+        }
+        return count;
+    }
+
+    void start() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    CounterSample stop() {
+        CounterSample sample;
+        auto finish = std::chrono::steady_clock::now();
+        sample.wall_ns = std::chrono::duration<double, std::nano>(finish - start_).count();
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (size_t i = 0; i < counter_count; ++i) {
+            uint64_t data[3] = {};
+            if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+                continue;
+            }
+            sample.values[i] = static_cast<double>(data[0]) * data[1] / data[2];
+            sample.valid[i] = true;
+        }
+#endif
+        return sample;
+    }
+};
@@ -0,0 +1,425 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <sys/types.h>
+#include <unistd.h>
+#ifdef VECTOR_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#include "vector.hpp"
+#pragma once
+
+struct AsyncIoOptions {
+    size_t chunk_bytes = size_t(1) << 20;
+    unsigned queue_depth = 8;
+    bool use_io_uring = true;
+};
+
+enum class AsyncIoOp {
+    read,
+    write
+};
+
+using AsyncProgress = std::function<void(size_t)>;
+
+class AsyncIoChunks {
+    size_t bytes_;
+    size_t chunk_bytes_;
+    std::vector<size_t> done_;
+    std::vector<char> finished_;
+    size_t prefix_chunks_ = 0;
+    size_t prefix_bytes_ = 0;
+    bool stopped_ = false;
+
+public:
+    AsyncIoChunks(size_t bytes, size_t chunk_bytes) : bytes_(bytes), chunk_bytes_(chunk_bytes),
+        done_((bytes + chunk_bytes - 1) / chunk_bytes, 0), finished_(done_.size(), 0) {}
+
+    size_t count() const noexcept {
+        return done_.size();
+    }
+
+    size_t offset(size_t chunk) const noexcept {
+        return chunk * chunk_bytes_ + done_[chunk];
+    }
+
+    size_t remaining(size_t chunk) const noexcept {
+        return std::min(chunk_bytes_, bytes_ - chunk * chunk_bytes_) - done_[chunk];
+    }
+
+    bool complete(size_t chunk, size_t transferred) noexcept {
+        done_[chunk] += transferred;
+        if (transferred == 0 || remaining(chunk) == 0) {
+            finished_[chunk] = 1;
+        }
+        return finished_[chunk];
+    }
+
+    bool advance() noexcept {
+        while (!stopped_ && prefix_chunks_ < count() && finished_[prefix_chunks_]) {
+            prefix_bytes_ += done_[prefix_chunks_];
+            stopped_ = remaining(prefix_chunks_) != 0;
+            prefix_chunks_++;
+        }
+        return stopped_ || prefix_chunks_ == count();
+    }
+
+    size_t transferred() const noexcept {
+        return prefix_bytes_;
+    }
+};
+
+inline ssize_t async_io_syscall(AsyncIoOp op, int fd, char* buffer, size_t bytes, off_t offset) {
+    ssize_t res;
+    do {
+        res = (op == AsyncIoOp::read) ? ::pread(fd, buffer, bytes, offset) : ::pwrite(fd, buffer, bytes, offset);
+    } while (res < 0 && errno == EINTR);
+    return res;
+}
+
+inline size_t threaded_transfer(AsyncIoOp op, int fd, char* buffer, size_t bytes, off_t offset,
+                                const AsyncIoOptions& options, const AsyncProgress& progress) {
+    AsyncIoChunks chunks(bytes, std::max<size_t>(options.chunk_bytes, 1));
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::exception_ptr error;
+    std::atomic<size_t> next = 0;
+
+    auto worker = [&] {
+        for (size_t chunk = next++; chunk < chunks.count(); chunk = next++) {
+            bool finished = false;
+            while (!finished) {
+                const size_t pos = chunks.offset(chunk);
+                ssize_t res = async_io_syscall(op, fd, buffer + pos, chunks.remaining(chunk), offset + pos);
+                std::lock_guard lock(mutex);
+                if (res < 0 || (res == 0 && op == AsyncIoOp::write)) {
+                    next = chunks.count();
+                    if (!error) {
+                        error = std::make_exception_ptr(std::system_error(res < 0 ? errno : EIO, std::system_category(), "async io"));
+                    }
+                    chunks.complete(chunk, 0);
+                    finished = true;
+                } else {
+                    finished = chunks.complete(chunk, res);
+                }
+                if (finished) {
+                    ready.notify_all();
+                }
+            }
+        }
+    };
+
+    std::vector<std::jthread> team;
+    const size_t threads = std::min<size_t>(std::max(options.queue_depth, 1u), chunks.count());
+    for (size_t i = 0; i < threads; ++i) {
+        team.emplace_back(worker);
+    }
+
+    size_t reported = 0;
+    for (;;) {
+        std::unique_lock lock(mutex);
+        bool done = false;
+        ready.wait(lock, [&] {
+            done = chunks.advance();
+            return error || done || chunks.transferred() != reported;
+        });
+        const size_t transferred = chunks.transferred();
+        lock.unlock();
+        if (error) {
+            break;
+        }
+        if (progress && transferred != reported) {
+            progress(transferred);
+        }
+        reported = transferred;
+        if (done) {
+            break;
+        }
+    }
+    team.clear();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return chunks.transferred();
+}
+
+#ifdef VECTOR_HAVE_IO_URING
+class IoUring {
+    int fd_ = -1;
+    unsigned entries_ = 0;
+    unsigned pending_ = 0;
+
+    void* sq_ring_ = MAP_FAILED;
+    void* cq_ring_ = MAP_FAILED;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    void* map(size_t size, off_t offset) {
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        if (ptr == MAP_FAILED) {
+            throw std::system_error(errno, std::system_category(), "io_uring mmap");
+        }
+        return ptr;
+    }
+
+    void require_read_write() {
+        constexpr size_t probe_ops = 256;
+        std::vector<unsigned char> storage(sizeof(io_uring_probe) + probe_ops * sizeof(io_uring_probe_op));
+        io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+        if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, probe_ops) < 0) {
+            throw std::system_error(errno, std::system_category(), "io_uring probe");
+        }
+        for (unsigned op : {unsigned(IORING_OP_READ), unsigned(IORING_OP_WRITE)}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                throw std::system_error(EOPNOTSUPP, std::system_category(), "io_uring read/write");
+            }
+        }
+    }
+
+    void release() noexcept {
+        if (sqes_ != MAP_FAILED) {
+            ::munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != MAP_FAILED) {
+            ::munmap(sq_ring_, sq_ring_size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+public:
+    explicit IoUring(unsigned entries) {
+        io_uring_params params{};
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::system_category(), "io_uring_setup");
+        }
+        try {
+            require_read_write();
+            entries_ = params.sq_entries;
+            sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (single_mmap) {
+                sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+            }
+            sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+            cq_ring_ = single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            sqes_ = static_cast<io_uring_sqe*>(map(sqes_size_, IORING_OFF_SQES));
+        } catch (...) {
+            release();
+            throw;
+        }
+
+        char* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        char* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    ~IoUring() {
+        release();
+    }
+
+    unsigned entries() const noexcept {
+        return entries_;
+    }
+
+    bool push(AsyncIoOp op, int fd, char* buffer, unsigned bytes, uint64_t offset, uint64_t user_data) noexcept {
+        const unsigned tail = *sq_tail_;
+        const unsigned head = std::atomic_ref(*sq_head_).load(std::memory_order_acquire);
+        if (tail - head >= entries_) {
+            return false;
+        }
+        const unsigned index = tail & sq_mask_;
+        io_uring_sqe* sqe = sqes_ + index;
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = (op == AsyncIoOp::read) ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(buffer);
+        sqe->len = bytes;
+        sqe->off = offset;
+        sqe->user_data = user_data;
+        sq_array_[index] = index;
+        std::atomic_ref(*sq_tail_).store(tail + 1, std::memory_order_release);
+        pending_++;
+        return true;
+    }
+
+    void submit_and_wait(unsigned wait) {
+        int res = static_cast<int>(::syscall(__NR_io_uring_enter, fd_, pending_, wait,
+                                             wait ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+        if (res < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                return;
+            }
+            throw std::system_error(errno, std::system_category(), "io_uring_enter");
+        }
+        pending_ -= static_cast<unsigned>(res);
+    }
+
+    bool pop(io_uring_cqe& cqe) noexcept {
+        const unsigned head = *cq_head_;
+        const unsigned tail = std::atomic_ref(*cq_tail_).load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        cqe = cqes_[head & cq_mask_];
+        std::atomic_ref(*cq_head_).store(head + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+inline size_t io_uring_transfer(IoUring& ring, AsyncIoOp op, int fd, char* buffer, size_t bytes, off_t offset,
+                                const AsyncIoOptions& options, const AsyncProgress& progress) {
+    AsyncIoChunks chunks(bytes, std::clamp<size_t>(options.chunk_bytes, 1, 1u << 30));
+    const size_t depth = std::min<size_t>(std::max(options.queue_depth, 1u), ring.entries());
+    std::vector<size_t> retry;
+    size_t next = 0;
+    size_t inflight = 0;
+
+    auto submit = [&](size_t chunk) {
+        const size_t pos = chunks.offset(chunk);
+        ring.push(op, fd, buffer + pos, static_cast<unsigned>(chunks.remaining(chunk)), offset + pos, chunk);
+        inflight++;
+    };
+
+    size_t reported = 0;
+    auto advance = [&] {
+        bool done = chunks.advance();
+        if (progress && chunks.transferred() != reported) {
+            reported = chunks.transferred();
+            progress(reported);
+        }
+        return done;
+    };
+
+    while (!advance() || inflight > 0) {
+        while (inflight < depth && !retry.empty()) {
+            submit(retry.back());
+            retry.pop_back();
+        }
+        while (inflight < depth && next < chunks.count()) {
+            submit(next++);
+        }
+        ring.submit_and_wait(1);
+        io_uring_cqe cqe;
+        while (ring.pop(cqe)) {
+            inflight--;
+            const size_t chunk = static_cast<size_t>(cqe.user_data);
+            if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+                retry.push_back(chunk);
+            } else if (cqe.res < 0 || (cqe.res == 0 && op == AsyncIoOp::write)) {
+                const int failure = cqe.res < 0 ? -cqe.res : EIO;
+                while (inflight > 0) {
+                    ring.submit_and_wait(1);
+                    while (inflight > 0 && ring.pop(cqe)) {
+                        inflight--;
+                    }
+                }
+                throw std::system_error(failure, std::system_category(), "async io");
+            } else if (!chunks.complete(chunk, static_cast<size_t>(cqe.res))) {
+                retry.push_back(chunk);
+            }
+        }
+    }
+    return chunks.transferred();
+}
+#endif
+
+inline size_t async_transfer(AsyncIoOp op, int fd, char* buffer, size_t bytes, off_t offset,
+                             const AsyncIoOptions& options, const AsyncProgress& progress) {
+    if (bytes == 0) {
+        return 0;
+    }
+#ifdef VECTOR_HAVE_IO_URING
+    if (options.use_io_uring) {
+        std::optional<IoUring> ring;
+        try {
+            ring.emplace(std::max(options.queue_depth, 1u));
+        } catch (const std::system_error&) {
+        }
+        if (ring) {
+            return io_uring_transfer(*ring, op, fd, buffer, bytes, offset, options, progress);
+        }
+    }
+#endif
+    return threaded_transfer(op, fd, buffer, bytes, offset, options, progress);
+}
+
+template<typename T, typename Allocator>
+std::future<size_t> async_read(int fd, Vector<T, Allocator>& vec, size_t count, off_t offset = 0,
+                               AsyncIoOptions options = {}, std::function<void(size_t, size_t)> on_chunk = {}) {
+    vec.clear();
+    vec.resize_for_overwrite(count);
+    options.chunk_bytes = std::max<size_t>(options.chunk_bytes / sizeof(T), 1) * sizeof(T);
+    return std::async(std::launch::async, [fd, &vec, count, offset, options, on_chunk = std::move(on_chunk)] {
+        size_t delivered = 0;
+        AsyncProgress progress = [&](size_t bytes) {
+            size_t elements = bytes / sizeof(T);
+            if (elements > delivered) {
+                if (on_chunk) {
+                    on_chunk(delivered, elements);
+                }
+                delivered = elements;
+            }
+        };
+        char* buffer = reinterpret_cast<char*>(vec.data());
+        try {
+            size_t bytes = async_transfer(AsyncIoOp::read, fd, buffer, count * sizeof(T), offset, options, progress);
+            vec.resize_for_overwrite(bytes / sizeof(T));
+        } catch (...) {
+            vec.resize_for_overwrite(delivered);
+            throw;
+        }
+        return vec.size();
+    });
+}
+
+template<typename T, typename Allocator>
+std::future<size_t> async_write(int fd, const Vector<T, Allocator>& vec, off_t offset = 0, AsyncIoOptions options = {}) {
+    static_assert(std::is_trivially_copyable_v<T>, "async_write requires a trivially copyable element type");
+    options.chunk_bytes = std::max<size_t>(options.chunk_bytes / sizeof(T), 1) * sizeof(T);
+    return std::async(std::launch::async, [fd, &vec, offset, options] {
+        char* buffer = const_cast<char*>(reinterpret_cast<const char*>(vec.data()));
+        size_t bytes = async_transfer(AsyncIoOp::write, fd, buffer, vec.size() * sizeof(T), offset, options, {});
+        return bytes / sizeof(T);
+    });
+}
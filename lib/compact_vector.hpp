@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "vector.hpp"
+#pragma once
+
+template<typename T, typename SizeType = uint32_t, typename Allocator = std::allocator<T>>
+class CompactVector {
+    struct Header {
+        SizeType size;
+        SizeType capacity;
+    };
+
+    static constexpr size_t alignment = std::max(alignof(Header), alignof(T));
+    static constexpr size_t offset = (sizeof(Header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    struct alignas(alignment) Unit {
+        unsigned char bytes[alignment];
+    };
+
+    using unit_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Unit>;
+
+    [[no_unique_address]] Allocator alloc_;
+    Header* header_ = nullptr;
+
+    static size_t units(size_t capacity) noexcept {
+        return (offset + capacity * sizeof(T) + alignment - 1) / alignment;
+    }
+
+    T* elements() const noexcept {
+        return header_ ? std::launder(reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(header_) + offset)) : nullptr;
+    }
+
+    void reallocate(size_t new_capacity) {
+        if (new_capacity > std::numeric_limits<SizeType>::max()) {
+            throw std::length_error("CompactVector capacity exceeds SizeType");
+        }
+        unit_allocator units_alloc(alloc_);
+        Unit* block = std::allocator_traits<unit_allocator>::allocate(units_alloc, units(new_capacity));
+        Header* new_header = ::new (static_cast<void*>(block)) Header{static_cast<SizeType>(size()), static_cast<SizeType>(new_capacity)};
+        T* new_massive = reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(block) + offset);
+        T* old_massive = elements();
+        for (size_t i = 0; i < size(); ++i) {
+            std::allocator_traits<Allocator>::construct(alloc_, new_massive + i, std::move_if_noexcept(old_massive[i]));
+        }
+        release();
+        header_ = new_header;
+    }
+
+    void release() noexcept {
+        if (!header_) {
+            return;
+        }
+        T* massive = elements();
+        for (size_t i = 0; i < size(); ++i) {
+            std::allocator_traits<Allocator>::destroy(alloc_, massive + i);
+        }
+        unit_allocator units_alloc(alloc_);
+        std::allocator_traits<unit_allocator>::deallocate(units_alloc, reinterpret_cast<Unit*>(header_), units(header_->capacity));
+        header_ = nullptr;
+    }
+
+    void allocate() {
+        constexpr size_t max_capacity = std::numeric_limits<SizeType>::max();
+        if (size() == max_capacity) {
+            throw std::length_error("CompactVector size exceeds SizeType");
+        }
+        reallocate((capacity() == 0) ? 1 : std::min(capacity() * 2, max_capacity));
+    }
+
+public:
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = SizeType;
+    using iterator = typename Vector<T, Allocator>::iterator;
+    using const_iterator = typename Vector<T, Allocator>::const_iterator;
+
+    CompactVector() {};
+
+    constexpr explicit CompactVector(const Allocator& alloc) noexcept : alloc_(alloc) {};
+
+    CompactVector(std::initializer_list<T> ilist, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        reserve(ilist.size());
+        for (const auto& i : ilist) {
+            push_back(i);
+        }
+    }
+
+    CompactVector(const CompactVector& vec) : alloc_(vec.alloc_) {
+        reserve(vec.size());
+        for (size_t i = 0; i < vec.size(); i++) {
+            push_back(vec[i]);
+        }
+    }
+
+    CompactVector(CompactVector&& vec) noexcept : alloc_(std::move(vec.alloc_)), header_(vec.header_) {
+        vec.header_ = nullptr;
+    }
+
+    ~CompactVector() {
+        release();
+    }
+
+    void swap(CompactVector& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(header_, other.header_);
+    }
+
+    CompactVector& operator=(const CompactVector& vec) {
+        CompactVector copy(vec);
+        swap(copy);
+        return *this;
+    }
+
+    CompactVector& operator=(CompactVector&& vec) noexcept {
+        CompactVector copy(std::move(vec));
+        swap(copy);
+        return *this;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        if (size() == capacity()) {
+            allocate();
+        }
+        std::allocator_traits<Allocator>::construct(alloc_, elements() + size(), std::forward<Args>(args)...);
+        header_->size++;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() noexcept {
+        if (size() == 0) {
+            return;
+        }
+        header_->size--;
+        std::allocator_traits<Allocator>::destroy(alloc_, elements() + size());
+    }
+
+    reference operator[] (size_t index) {
+        return elements()[index];
+    }
+
+    const_reference operator[] (size_t index) const {
+        return elements()[index];
+    }
+
+    reference at(size_t index) {
+        return elements()[index];
+    }
+
+    const_reference at(size_t index) const {
+        return elements()[index];
+    }
+
+    reference front() {
+        return elements()[0];
+    }
+
+    const_reference front() const {
+        return elements()[0];
+    }
+
+    reference back() {
+        return elements()[size() - 1];
+    }
+
+    const_reference back() const {
+        return elements()[size() - 1];
+    }
+
+    T* data() {
+        return elements();
+    }
+
+    const T* data() const {
+        return elements();
+    }
+
+    size_t size() const {
+        return header_ ? header_->size : 0;
+    }
+
+    size_t capacity() const {
+        return header_ ? header_->capacity : 0;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    void clear() noexcept {
+        while (!empty()) {
+            pop_back();
+        }
+    }
+
+    void shrink_to_fit() {
+        if (empty()) {
+            release();
+        } else if (size() < capacity()) {
+            reallocate(size());
+        }
+    }
+
+    void reserve(size_t size) {
+        if (size > capacity()) {
+            reallocate(size);
+        }
+    }
+
+    void resize(size_t size, const T& value = T{}) {
+        reserve(size);
+        while (this->size() < size) {
+            push_back(value);
+        }
+        while (this->size() > size) {
+            pop_back();
+        }
+    }
+
+    constexpr Allocator get_allocator() const {
+        return alloc_;
+    }
+
+    iterator begin() {
+        return iterator{elements(), 0};
+    }
+
+    const_iterator begin() const {
+        return const_iterator{elements(), 0};
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator{elements(), 0};
+    }
+
+    iterator end() {
+        return iterator{elements(), size()};
+    }
+
+    const_iterator end() const {
+        return const_iterator{elements(), size()};
+    }
+
+    const_iterator cend() const {
+        return const_iterator{elements(), size()};
+    }
+};
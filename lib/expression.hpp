@@ -0,0 +1,244 @@
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "parallel.hpp"
+#include "vector.hpp"
+#pragma once
+
+template<typename T>
+concept Numeric = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template<Numeric T>
+class VectorOperand {
+    const T* data_;
+    size_t size_;
+
+public:
+    using value_type = T;
+    using expression_tag = void;
+
+    VectorOperand(const T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    value_type operator[](size_t index) const noexcept {
+        return data_[index];
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+};
+
+template<Numeric T>
+class ScalarOperand {
+    T value_;
+    size_t size_;
+
+public:
+    using value_type = T;
+    using expression_tag = void;
+
+    ScalarOperand(T value, size_t size) noexcept : value_(value), size_(size) {}
+
+    value_type operator[](size_t) const noexcept {
+        return value_;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+};
+
+template<typename Op, VectorExpression E>
+class UnaryExpression {
+    E operand_;
+
+public:
+    using value_type = typename E::value_type;
+    using expression_tag = void;
+
+    explicit UnaryExpression(const E& operand) : operand_(operand) {}
+
+    value_type operator[](size_t index) const {
+        return static_cast<value_type>(Op{}(operand_[index]));
+    }
+
+    size_t size() const noexcept {
+        return operand_.size();
+    }
+};
+
+template<typename Op, VectorExpression L, VectorExpression R>
+class BinaryExpression {
+    L lhs_;
+    R rhs_;
+
+public:
+    using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+    using expression_tag = void;
+
+    BinaryExpression(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {
+        if (lhs_.size() != rhs_.size()) {
+            throw std::invalid_argument("vector expression: operand sizes differ");
+        }
+    }
+
+    value_type operator[](size_t index) const {
+        return static_cast<value_type>(Op{}(lhs_[index], rhs_[index]));
+    }
+
+    size_t size() const noexcept {
+        return lhs_.size();
+    }
+};
+
+template<VectorExpression E>
+const E& as_expression(const E& expr) noexcept {
+    return expr;
+}
+
+template<Numeric T, typename Allocator>
+VectorOperand<T> as_expression(const Vector<T, Allocator>& vec) noexcept {
+    return VectorOperand<T>(vec.data(), vec.size());
+}
+
+template<typename E>
+concept ExpressionOperand = requires(const E& operand) {
+    as_expression(operand);
+};
+
+template<ExpressionOperand E>
+using expression_t = std::remove_cvref_t<decltype(as_expression(std::declval<const E&>()))>;
+
+template<ExpressionOperand E>
+using expression_value_t = typename expression_t<E>::value_type;
+
+template<typename Op, ExpressionOperand L, ExpressionOperand R>
+auto make_expression(const L& lhs, const R& rhs) {
+    return BinaryExpression<Op, expression_t<L>, expression_t<R>>(as_expression(lhs), as_expression(rhs));
+}
+
+template<typename Op, ExpressionOperand E>
+auto make_expression(const E& lhs, std::type_identity_t<expression_value_t<E>> rhs) {
+    using T = expression_value_t<E>;
+    return make_expression<Op>(lhs, ScalarOperand<T>(rhs, as_expression(lhs).size()));
+}
+
+template<typename Op, ExpressionOperand E>
+auto make_expression(std::type_identity_t<expression_value_t<E>> lhs, const E& rhs) {
+    using T = expression_value_t<E>;
+    return make_expression<Op>(ScalarOperand<T>(lhs, as_expression(rhs).size()), rhs);
+}
+
+template<ExpressionOperand L, ExpressionOperand R>
+auto operator+(const L& lhs, const R& rhs) {
+    return make_expression<std::plus<>>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator+(const E& lhs, std::type_identity_t<expression_value_t<E>> rhs) {
+    return make_expression<std::plus<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator+(std::type_identity_t<expression_value_t<E>> lhs, const E& rhs) {
+    return make_expression<std::plus<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand L, ExpressionOperand R>
+auto operator-(const L& lhs, const R& rhs) {
+    return make_expression<std::minus<>>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator-(const E& lhs, std::type_identity_t<expression_value_t<E>> rhs) {
+    return make_expression<std::minus<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator-(std::type_identity_t<expression_value_t<E>> lhs, const E& rhs) {
+    return make_expression<std::minus<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand L, ExpressionOperand R>
+auto operator*(const L& lhs, const R& rhs) {
+    return make_expression<std::multiplies<>>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator*(const E& lhs, std::type_identity_t<expression_value_t<E>> rhs) {
+    return make_expression<std::multiplies<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator*(std::type_identity_t<expression_value_t<E>> lhs, const E& rhs) {
+    return make_expression<std::multiplies<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand L, ExpressionOperand R>
+auto operator/(const L& lhs, const R& rhs) {
+    return make_expression<std::divides<>>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator/(const E& lhs, std::type_identity_t<expression_value_t<E>> rhs) {
+    return make_expression<std::divides<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator/(std::type_identity_t<expression_value_t<E>> lhs, const E& rhs) {
+    return make_expression<std::divides<>, E>(lhs, rhs);
+}
+
+template<ExpressionOperand E>
+auto operator-(const E& operand) {
+    return UnaryExpression<std::negate<>, expression_t<E>>(as_expression(operand));
+}
+
+template<VectorExpression E>
+auto sum_range(const E& expr, size_t first, size_t last) {
+    using T = typename E::value_type;
+    constexpr size_t lanes = 8;
+    T partial[lanes] = {};
+    size_t i = first;
+    for (; i + lanes <= last; i += lanes) {
+        for (size_t j = 0; j < lanes; ++j) {
+            partial[j] += expr[i + j];
+        }
+    }
+    T total{};
+    for (size_t j = 0; j < lanes; ++j) {
+        total += partial[j];
+    }
+    for (; i < last; ++i) {
+        total += expr[i];
+    }
+    return total;
+}
+
+template<ExpressionOperand E>
+auto sum(const E& operand) {
+    const auto& expr = as_expression(operand);
+    return sum_range(expr, 0, expr.size());
+}
+
+template<ExpressionOperand E>
+auto sum(const E& operand, const ParallelPolicy& policy) {
+    using T = expression_value_t<E>;
+    const auto& expr = as_expression(operand);
+    const size_t count = expr.size();
+    const size_t threads = parallel_threads(count, policy);
+    const size_t chunk = (count + threads - 1) / threads;
+    std::vector<T> partials(threads);
+    ParallelPolicy per_chunk{threads, 1, policy.pin_threads};
+    parallel_for(threads, per_chunk, [&](size_t first, size_t last) {
+        for (size_t t = first; t < last; ++t) {
+            partials[t] = sum_range(expr, std::min(count, t * chunk), std::min(count, (t + 1) * chunk));
+        }
+    });
+    T total{};
+    for (const T& partial : partials) {
+        total += partial;
+    }
+    return total;
+}
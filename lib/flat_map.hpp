@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include "vector.hpp"
+#include "flat_search.hpp"
+#include "index_iterator.hpp"
+#pragma once
+
+template<typename Key, typename Value, typename Compare = std::less<Key>, typename Search = BinarySearch>
+class FlatMap {
+    Vector<Key> keys_;
+    Vector<Value> values_;
+    Compare comp_;
+    Search search_;
+
+    bool equal(const Key& lhs, const Key& rhs) const {
+        return !comp_(lhs, rhs) && !comp_(rhs, lhs);
+    }
+
+    void truncate(size_t size) noexcept {
+        while (keys_.size() > size) {
+            keys_.pop_back();
+            values_.pop_back();
+        }
+    }
+
+    void erase_at(size_t pos) {
+        std::move(keys_.data() + pos + 1, keys_.data() + keys_.size(), keys_.data() + pos);
+        std::move(values_.data() + pos + 1, values_.data() + values_.size(), values_.data() + pos);
+        truncate(keys_.size() - 1);
+    }
+
+    struct EntryAccess {
+        std::pair<const Key&, Value&> operator()(FlatMap& map, size_t index) const {
+            return {map.keys_[index], map.values_[index]};
+        }
+
+        std::pair<const Key&, const Value&> operator()(const FlatMap& map, size_t index) const {
+            return {map.keys_[index], map.values_[index]};
+        }
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = size_t;
+    using key_compare = Compare;
+
+    using iterator = IndexIterator<FlatMap, std::pair<const Key&, Value&>, EntryAccess>;
+    using const_iterator = IndexIterator<const FlatMap, std::pair<const Key&, const Value&>, EntryAccess>;
+
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& comp) : comp_(comp) {}
+
+    FlatMap(std::initializer_list<std::pair<Key, Value>> ilist, const Compare& comp = Compare()) : comp_(comp) {
+        insert_batch(ilist);
+    }
+
+    iterator begin() {
+        return iterator{this, 0};
+    }
+
+    const_iterator begin() const {
+        return const_iterator{this, 0};
+    }
+
+    iterator end() {
+        return iterator{this, keys_.size()};
+    }
+
+    const_iterator end() const {
+        return const_iterator{this, keys_.size()};
+    }
+
+    const Vector<Key>& keys() const noexcept {
+        return keys_;
+    }
+
+    const Vector<Value>& values() const noexcept {
+        return values_;
+    }
+
+    size_t size() const {
+        return keys_.size();
+    }
+
+    bool empty() const noexcept {
+        return keys_.empty();
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+        search_.rebuild(keys_, comp_);
+    }
+
+    void reserve(size_t size) {
+        if (size > keys_.capacity()) {
+            keys_.reserve(size);
+        }
+        if (size > values_.capacity()) {
+            values_.reserve(size);
+        }
+    }
+
+    size_t lower_bound_index(const Key& key) const {
+        return search_.lower_bound(keys_, key, comp_);
+    }
+
+    iterator find(const Key& key) {
+        size_t pos = lower_bound_index(key);
+        if (pos != keys_.size() && equal(keys_[pos], key)) {
+            return iterator{this, pos};
+        }
+        return end();
+    }
+
+    const_iterator find(const Key& key) const {
+        size_t pos = lower_bound_index(key);
+        if (pos != keys_.size() && equal(keys_[pos], key)) {
+            return const_iterator{this, pos};
+        }
+        return end();
+    }
+
+    bool contains(const Key& key) const {
+        return find(key) != end();
+    }
+
+    size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    Value& at(const Key& key) {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at");
+        }
+        return it->second;
+    }
+
+    const Value& at(const Key& key) const {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at");
+        }
+        return it->second;
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        size_t pos = lower_bound_index(key);
+        if (pos != keys_.size() && equal(keys_[pos], key)) {
+            return {iterator{this, pos}, false};
+        }
+        values_.emplace(values_.begin() + pos, std::forward<Args>(args)...);
+        try {
+            keys_.insert(keys_.begin() + pos, key);
+        } catch (...) {
+            std::move(values_.data() + pos + 1, values_.data() + values_.size(), values_.data() + pos);
+            values_.pop_back();
+            throw;
+        }
+        search_.rebuild(keys_, comp_);
+        return {iterator{this, pos}, true};
+    }
+
+    std::pair<iterator, bool> insert(const Key& key, const Value& value) {
+        return try_emplace(key, value);
+    }
+
+    bool erase(const Key& key) {
+        size_t pos = lower_bound_index(key);
+        if (pos == keys_.size() || !equal(keys_[pos], key)) {
+            return false;
+        }
+        erase_at(pos);
+        search_.rebuild(keys_, comp_);
+        return true;
+    }
+
+    template <std::ranges::input_range Range>
+    size_t insert_batch(Range&& range) {
+        const size_t old_size = keys_.size();
+        if constexpr (std::ranges::sized_range<Range>) {
+            reserve(old_size + std::ranges::size(range));
+        }
+        try {
+            for (auto&& [key, value] : range) {
+                keys_.emplace_back(key);
+                try {
+                    values_.emplace_back(value);
+                } catch (...) {
+                    keys_.pop_back();
+                    throw;
+                }
+            }
+        } catch (...) {
+            truncate(old_size);
+            throw;
+        }
+        const size_t batch_size = keys_.size() - old_size;
+
+        Vector<size_t> order;
+        order.resize(batch_size);
+        std::iota(order.data(), order.data() + batch_size, old_size);
+        std::stable_sort(order.data(), order.data() + batch_size, [this](size_t lhs, size_t rhs) {
+            return comp_(keys_[lhs], keys_[rhs]);
+        });
+
+        Vector<Key> batch_keys;
+        Vector<Value> batch_values;
+        batch_keys.reserve(batch_size);
+        batch_values.reserve(batch_size);
+        const Key* old_first = keys_.data();
+        const Key* old_last = keys_.data() + old_size;
+        for (size_t i = 0; i < batch_size; ++i) {
+            const Key& key = keys_[order[i]];
+            if (!batch_keys.empty() && equal(batch_keys.back(), key)) {
+                continue;
+            }
+            const Key* pos = std::lower_bound(old_first, old_last, key, comp_);
+            if (pos != old_last && equal(*pos, key)) {
+                continue;
+            }
+            batch_keys.emplace_back(std::move(keys_[order[i]]));
+            batch_values.emplace_back(std::move(values_[order[i]]));
+        }
+        truncate(old_size + batch_keys.size());
+
+        size_t i = old_size;
+        size_t j = batch_keys.size();
+        size_t out = keys_.size();
+        while (j > 0) {
+            out--;
+            if (i > 0 && comp_(batch_keys[j - 1], keys_[i - 1])) {
+                i--;
+                keys_[out] = std::move(keys_[i]);
+                values_[out] = std::move(values_[i]);
+            } else {
+                j--;
+                keys_[out] = std::move(batch_keys[j]);
+                values_[out] = std::move(batch_values[j]);
+            }
+        }
+        search_.rebuild(keys_, comp_);
+        return batch_keys.size();
+    }
+};
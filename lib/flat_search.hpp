@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <bit>
+#include "vector.hpp"
+#pragma once
+
+struct BinarySearch {
+    template<typename Key, typename Compare>
+    void rebuild(const Vector<Key>&, const Compare&) {}
+
+    template<typename Key, typename Compare>
+    size_t lower_bound(const Vector<Key>& keys, const Key& key, const Compare& comp) const {
+        return std::lower_bound(keys.data(), keys.data() + keys.size(), key, comp) - keys.data();
+    }
+};
+
+struct BranchlessSearch {
+    template<typename Key, typename Compare>
+    void rebuild(const Vector<Key>&, const Compare&) {}
+
+    template<typename Key, typename Compare>
+    size_t lower_bound(const Vector<Key>& keys, const Key& key, const Compare& comp) const {
+        size_t len = keys.size();
+        if (len == 0) {
+            return 0;
+        }
+        const Key* base = keys.data();
+        while (len > 1) {
+            size_t half = len / 2;
+            base += comp(base[half], key) ? half : 0;
+            len -= half;
+        }
+        return (base - keys.data()) + comp(*base, key);
+    }
+};
+
+template<typename Key>
+class EytzingerSearch {
+    Vector<Key> tree_;
+    Vector<size_t> rank_;
+
+    void build(const Vector<Key>& keys, size_t& i, size_t k) {
+        if (k > keys.size()) {
+            return;
+        }
+        build(keys, i, 2 * k);
+        tree_[k] = keys[i];
+        rank_[k] = i++;
+        build(keys, i, 2 * k + 1);
+    }
+
+public:
+    template<typename Compare>
+    void rebuild(const Vector<Key>& keys, const Compare&) {
+        tree_.clear();
+        rank_.clear();
+        if (keys.empty()) {
+            return;
+        }
+        tree_.resize(keys.size() + 1, keys[0]);
+        rank_.resize(keys.size() + 1);
+        size_t i = 0;
+        build(keys, i, 1);
+    }
+
+    template<typename Compare>
+    size_t lower_bound(const Vector<Key>& keys, const Key& key, const Compare& comp) const {
+        const size_t n = keys.size();
+        size_t k = 1;
+        while (k <= n) {
+            k = 2 * k + comp(tree_[k], key);
+        }
+        k >>= std::countr_one(k) + 1;
+        return (k == 0) ? n : rank_[k];
+    }
+};
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include "vector.hpp"
+#include "flat_search.hpp"
+#pragma once
+
+template<typename Key, typename Compare = std::less<Key>, typename Search = BinarySearch>
+class FlatSet {
+    Vector<Key> keys_;
+    Compare comp_;
+    Search search_;
+
+    bool equal(const Key& lhs, const Key& rhs) const {
+        return !comp_(lhs, rhs) && !comp_(rhs, lhs);
+    }
+
+    void truncate(size_t size) noexcept {
+        while (keys_.size() > size) {
+            keys_.pop_back();
+        }
+    }
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using const_iterator = typename Vector<Key>::const_iterator;
+    using iterator = const_iterator;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& comp) : comp_(comp) {}
+
+    FlatSet(std::initializer_list<Key> ilist, const Compare& comp = Compare()) : comp_(comp) {
+        insert_batch(ilist);
+    }
+
+    const_iterator begin() const {
+        return keys_.begin();
+    }
+
+    const_iterator end() const {
+        return keys_.end();
+    }
+
+    const Vector<Key>& keys() const noexcept {
+        return keys_;
+    }
+
+    size_t size() const {
+        return keys_.size();
+    }
+
+    bool empty() const noexcept {
+        return keys_.empty();
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        search_.rebuild(keys_, comp_);
+    }
+
+    void reserve(size_t size) {
+        if (size > keys_.capacity()) {
+            keys_.reserve(size);
+        }
+    }
+
+    size_t lower_bound_index(const Key& key) const {
+        return search_.lower_bound(keys_, key, comp_);
+    }
+
+    const_iterator find(const Key& key) const {
+        size_t pos = lower_bound_index(key);
+        if (pos != keys_.size() && equal(keys_[pos], key)) {
+            return begin() + pos;
+        }
+        return end();
+    }
+
+    bool contains(const Key& key) const {
+        return find(key) != end();
+    }
+
+    size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    bool insert(const Key& key) {
+        size_t pos = lower_bound_index(key);
+        if (pos != keys_.size() && equal(keys_[pos], key)) {
+            return false;
+        }
+        keys_.insert(keys_.begin() + pos, key);
+        search_.rebuild(keys_, comp_);
+        return true;
+    }
+
+    bool erase(const Key& key) {
+        size_t pos = lower_bound_index(key);
+        if (pos == keys_.size() || !equal(keys_[pos], key)) {
+            return false;
+        }
+        std::move(keys_.data() + pos + 1, keys_.data() + keys_.size(), keys_.data() + pos);
+        keys_.pop_back();
+        search_.rebuild(keys_, comp_);
+        return true;
+    }
+
+    template <std::ranges::input_range Range>
+    size_t insert_batch(Range&& range) {
+        const size_t old_size = keys_.size();
+        if constexpr (std::ranges::sized_range<Range>) {
+            reserve(old_size + std::ranges::size(range));
+        }
+        for (auto&& i : range) {
+            keys_.emplace_back(std::forward<decltype(i)>(i));
+        }
+
+        Key* first = keys_.data();
+        Key* middle = first + old_size;
+        Key* last = first + keys_.size();
+
+        std::sort(middle, last, comp_);
+        Key* tail_end = std::unique(middle, last, [this](const Key& lhs, const Key& rhs) {
+            return equal(lhs, rhs);
+        });
+        tail_end = std::remove_if(middle, tail_end, [&](const Key& key) {
+            Key* pos = std::lower_bound(first, middle, key, comp_);
+            return pos != middle && equal(*pos, key);
+        });
+        truncate(tail_end - first);
+
+        std::inplace_merge(keys_.data(), keys_.data() + old_size, keys_.data() + keys_.size(), comp_);
+        search_.rebuild(keys_, comp_);
+        return keys_.size() - old_size;
+    }
+};
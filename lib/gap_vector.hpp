@@ -0,0 +1,301 @@
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "index_iterator.hpp"
+#include "vector.hpp"
+#pragma once
+
+template<typename T, typename Allocator = std::allocator<T>>
+class GapVector {
+    Allocator alloc_;
+    T* data_ = nullptr;
+
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+    size_t capacity_ = 0;
+
+    size_t gap_size() const noexcept {
+        return gap_end_ - gap_begin_;
+    }
+
+    size_t slot(size_t index) const noexcept {
+        return (index < gap_begin_) ? index : index + gap_size();
+    }
+
+    void relocate(T* dst, T* src) {
+        std::allocator_traits<Allocator>::construct(alloc_, dst, std::move_if_noexcept(*src));
+        std::allocator_traits<Allocator>::destroy(alloc_, src);
+    }
+
+    void reallocate(size_t new_capacity) {
+        T* new_massive = std::allocator_traits<Allocator>::allocate(alloc_, new_capacity);
+        const size_t suffix = capacity_ - gap_end_;
+        const size_t new_gap_end = new_capacity - suffix;
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (data_) {
+                std::memcpy(new_massive, data_, gap_begin_ * sizeof(T));
+                std::memcpy(new_massive + new_gap_end, data_ + gap_end_, suffix * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < gap_begin_; ++i) {
+                relocate(new_massive + i, data_ + i);
+            }
+            for (size_t i = 0; i < suffix; ++i) {
+                relocate(new_massive + new_gap_end + i, data_ + gap_end_ + i);
+            }
+        }
+        if (data_) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+        }
+        data_ = new_massive;
+        gap_end_ = new_gap_end;
+        capacity_ = new_capacity;
+    }
+
+    void allocate() {
+        reallocate((capacity_ == 0) ? 1 : capacity_ * 2);
+    }
+
+    void destroy_all() noexcept {
+        for (size_t i = 0; i < gap_begin_; ++i) {
+            std::allocator_traits<Allocator>::destroy(alloc_, data_ + i);
+        }
+        for (size_t i = gap_end_; i < capacity_; ++i) {
+            std::allocator_traits<Allocator>::destroy(alloc_, data_ + i);
+        }
+    }
+
+public:
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = size_t;
+
+    using iterator = IndexIterator<GapVector, T&>;
+    using const_iterator = IndexIterator<const GapVector, const T&>;
+
+    GapVector() {};
+
+    constexpr explicit GapVector(const Allocator& alloc) noexcept : alloc_(alloc) {};
+
+    GapVector(std::initializer_list<T> ilist, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        reserve(ilist.size());
+        for (const auto& i : ilist) {
+            insert(i);
+        }
+    }
+
+    GapVector(const GapVector& gap) : alloc_(gap.alloc_) {
+        reserve(gap.size());
+        for (size_t i = 0; i < gap.size(); i++) {
+            insert(gap[i]);
+        }
+    }
+
+    GapVector(GapVector&& gap) noexcept : alloc_(std::move(gap.alloc_)), data_(gap.data_),
+        gap_begin_(gap.gap_begin_), gap_end_(gap.gap_end_), capacity_(gap.capacity_) {
+        gap.data_ = nullptr;
+        gap.gap_begin_ = 0;
+        gap.gap_end_ = 0;
+        gap.capacity_ = 0;
+    }
+
+    ~GapVector() {
+        destroy_all();
+        if (data_) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+        }
+    }
+
+    void swap(GapVector& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(data_, other.data_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    GapVector& operator=(const GapVector& gap) {
+        GapVector copy(gap);
+        swap(copy);
+        return *this;
+    }
+
+    GapVector& operator=(GapVector&& gap) noexcept {
+        GapVector copy(std::move(gap));
+        swap(copy);
+        return *this;
+    }
+
+    size_t cursor() const noexcept {
+        return gap_begin_;
+    }
+
+    void move_cursor(size_t pos) {
+        if (gap_begin_ == gap_end_) {
+            gap_begin_ = gap_end_ = pos;
+            return;
+        }
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (pos < gap_begin_) {
+                const size_t count = gap_begin_ - pos;
+                std::memmove(data_ + gap_end_ - count, data_ + pos, count * sizeof(T));
+                gap_begin_ -= count;
+                gap_end_ -= count;
+            } else if (pos > gap_begin_) {
+                const size_t count = pos - gap_begin_;
+                std::memmove(data_ + gap_begin_, data_ + gap_end_, count * sizeof(T));
+                gap_begin_ += count;
+                gap_end_ += count;
+            }
+        } else {
+            while (pos < gap_begin_) {
+                relocate(data_ + --gap_end_, data_ + --gap_begin_);
+            }
+            while (pos > gap_begin_) {
+                relocate(data_ + gap_begin_++, data_ + gap_end_++);
+            }
+        }
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        if (gap_begin_ == gap_end_) {
+            allocate();
+        }
+        std::allocator_traits<Allocator>::construct(alloc_, data_ + gap_begin_, std::forward<Args>(args)...);
+        gap_begin_++;
+    }
+
+    void insert(const T& value) {
+        emplace(value);
+    }
+
+    void insert(T&& value) {
+        emplace(std::move(value));
+    }
+
+    void insert(size_t pos, const T& value) {
+        move_cursor(pos);
+        emplace(value);
+    }
+
+    void insert(size_t pos, T&& value) {
+        move_cursor(pos);
+        emplace(std::move(value));
+    }
+
+    void erase_before() noexcept {
+        if (gap_begin_ == 0) {
+            return;
+        }
+        gap_begin_--;
+        std::allocator_traits<Allocator>::destroy(alloc_, data_ + gap_begin_);
+    }
+
+    void erase_after() noexcept {
+        if (gap_end_ == capacity_) {
+            return;
+        }
+        std::allocator_traits<Allocator>::destroy(alloc_, data_ + gap_end_);
+        gap_end_++;
+    }
+
+    void erase(size_t pos) {
+        move_cursor(pos);
+        erase_after();
+    }
+
+    void push_back(const T& value) {
+        insert(size(), value);
+    }
+
+    void push_back(T&& value) {
+        insert(size(), std::move(value));
+    }
+
+    reference operator[] (size_t index) {
+        return data_[slot(index)];
+    }
+
+    const_reference operator[] (size_t index) const {
+        return data_[slot(index)];
+    }
+
+    reference at(size_t index) {
+        return data_[slot(index)];
+    }
+
+    const_reference at(size_t index) const {
+        return data_[slot(index)];
+    }
+
+    size_t size() const {
+        return capacity_ - gap_size();
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    void clear() noexcept {
+        destroy_all();
+        gap_begin_ = 0;
+        gap_end_ = capacity_;
+    }
+
+    void reserve(size_t size) {
+        if (size > capacity_) {
+            reallocate(size);
+        }
+    }
+
+    constexpr Allocator get_allocator() const {
+        return alloc_;
+    }
+
+    Vector<T, Allocator> compact() const {
+        Vector<T, Allocator> vec(alloc_);
+        vec.reserve(size());
+        for (size_t i = 0; i < gap_begin_; ++i) {
+            vec.push_back(data_[i]);
+        }
+        for (size_t i = gap_end_; i < capacity_; ++i) {
+            vec.push_back(data_[i]);
+        }
+        return vec;
+    }
+
+    iterator begin() {
+        return iterator{this, 0};
+    }
+
+    const_iterator begin() const {
+        return const_iterator{this, 0};
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator{this, 0};
+    }
+
+    iterator end() {
+        return iterator{this, size()};
+    }
+
+    const_iterator end() const {
+        return const_iterator{this, size()};
+    }
+
+    const_iterator cend() const {
+        return const_iterator{this, size()};
+    }
+};
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+#include "vector.hpp"
+#pragma once
+
+inline constexpr size_t default_prefetch_distance = 16;
+
+template<typename T, typename Index>
+concept HardwareGatherable = std::is_trivially_copyable_v<T> && std::is_integral_v<Index> && sizeof(Index) == 4 &&
+    (sizeof(T) == 4 || sizeof(T) == 8);
+
+template<typename T, typename Index>
+void prefetch_indexed(const T* base, const Index* indices, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        __builtin_prefetch(base + indices[j], 0);
+    }
+}
+
+template<typename T, typename Index>
+size_t hardware_gather(const T* src, size_t src_size, const Index* indices, T* out, size_t count, size_t distance) {
+    size_t i = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    if constexpr (HardwareGatherable<T, Index>) {
+        if (src_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return 0;
+        }
+#if defined(__AVX512F__)
+        constexpr size_t lanes = 64 / sizeof(T);
+#else
+        constexpr size_t lanes = 32 / sizeof(T);
+#endif
+        for (; i + lanes <= count; i += lanes) {
+            prefetch_indexed(src, indices, std::min(i + distance, count), std::min(i + distance + lanes, count));
+#if defined(__AVX512F__)
+            if constexpr (sizeof(T) == 4) {
+                __m512i index = _mm512_loadu_si512(indices + i);
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi32(index, src, 4));
+            } else {
+                __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi64(index, src, 8));
+            }
+#else
+            if constexpr (sizeof(T) == 4) {
+                __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), index, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            } else {
+                __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src), index, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+#endif
+        }
+    }
+#else
+    (void)src;
+    (void)src_size;
+    (void)indices;
+    (void)out;
+    (void)count;
+    (void)distance;
+#endif
+    return i;
+}
+
+template<typename T, typename Index, typename SrcAllocator, typename IndexAllocator, typename OutAllocator>
+void gather(const Vector<T, SrcAllocator>& src, const Vector<Index, IndexAllocator>& indices,
+            Vector<T, OutAllocator>& out, size_t prefetch_distance = default_prefetch_distance) {
+    const size_t count = indices.size();
+    if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>) {
+        out.resize_for_overwrite(count);
+    } else {
+        out.resize(count);
+    }
+    const T* source = src.data();
+    const Index* index = indices.data();
+    T* target = out.data();
+
+    size_t i = hardware_gather(source, src.size(), index, target, count, prefetch_distance);
+    for (; i < count; ++i) {
+        if (i + prefetch_distance < count) {
+            __builtin_prefetch(source + index[i + prefetch_distance], 0);
+        }
+        target[i] = source[index[i]];
+    }
+}
+
+template<typename T, typename Index, typename SrcAllocator, typename IndexAllocator, typename DstAllocator>
+void scatter(const Vector<T, SrcAllocator>& src, const Vector<Index, IndexAllocator>& indices,
+             Vector<T, DstAllocator>& dst, size_t prefetch_distance = default_prefetch_distance) {
+    if (src.size() != indices.size()) {
+        throw std::invalid_argument("scatter: source and indices differ in size");
+    }
+    const size_t count = src.size();
+    const T* source = src.data();
+    const Index* index = indices.data();
+    T* target = dst.data();
+    for (size_t i = 0; i < count; ++i) {
+        if (i + prefetch_distance < count) {
+            __builtin_prefetch(target + index[i + prefetch_distance], 1);
+        }
+        target[index[i]] = source[i];
+    }
+}
+
+template<typename Index, typename IndexAllocator>
+std::vector<bool> validate_permutation(const Vector<Index, IndexAllocator>& perm, size_t count) {
+    if (perm.size() != count) {
+        throw std::invalid_argument("apply_permutation: permutation and vector differ in size");
+    }
+    std::vector<bool> seen(count, false);
+    for (size_t i = 0; i < count; ++i) {
+        const size_t target = static_cast<size_t>(perm[i]);
+        if (target >= count || seen[target]) {
+            throw std::invalid_argument("apply_permutation: indices do not form a permutation");
+        }
+        seen[target] = true;
+    }
+    return seen;
+}
+
+template<typename T, typename Index, typename Allocator, typename IndexAllocator>
+void apply_permutation(Vector<T, Allocator>& vec, const Vector<Index, IndexAllocator>& perm) {
+    const size_t count = vec.size();
+    std::vector<bool> visited = validate_permutation(perm, count);
+    visited.assign(count, false);
+    for (size_t start = 0; start < count; ++start) {
+        if (visited[start]) {
+            continue;
+        }
+        T carried = std::move(vec[start]);
+        size_t current = start;
+        for (;;) {
+            visited[current] = true;
+            const size_t next = static_cast<size_t>(perm[current]);
+            if (next == start) {
+                vec[current] = std::move(carried);
+                break;
+            }
+            __builtin_prefetch(vec.data() + perm[next], 0);
+            vec[current] = std::move(vec[next]);
+            current = next;
+        }
+    }
+}
+
+template<typename T, typename Index, typename Allocator, typename IndexAllocator>
+void apply_permutation(Vector<T, Allocator>& vec, const Vector<Index, IndexAllocator>& perm,
+                       Vector<T, Allocator>& scratch) {
+    validate_permutation(perm, vec.size());
+    gather(vec, perm, scratch);
+    vec.swap(scratch);
+}
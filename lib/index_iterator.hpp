@@ -0,0 +1,134 @@
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#pragma once
+
+struct SubscriptAccess {
+    template <typename Container>
+    decltype(auto) operator()(Container& container, size_t index) const {
+        return container[index];
+    }
+};
+
+template <typename Container, typename Reference, typename Access = SubscriptAccess>
+class IndexIterator {
+    struct ArrowProxy {
+        Reference ref;
+
+        std::remove_reference_t<Reference>* operator->() noexcept {
+            return std::addressof(ref);
+        }
+    };
+
+    Container* container_ = nullptr;
+    size_t index_ = 0;
+
+public:
+    using value_type = std::remove_cvref_t<Reference>;
+    using reference = Reference;
+    using pointer = std::conditional_t<std::is_lvalue_reference_v<Reference>,
+        std::add_pointer_t<Reference>, ArrowProxy>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::conditional_t<std::is_lvalue_reference_v<Reference>,
+        std::random_access_iterator_tag, std::input_iterator_tag>;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    IndexIterator(Container* container = nullptr, size_t index = 0) noexcept : container_(container), index_(index) {}
+
+    size_t index() const noexcept {
+        return index_;
+    }
+
+    IndexIterator& operator++() noexcept {
+        index_++;
+        return *this;
+    }
+
+    IndexIterator operator++(int) noexcept {
+        IndexIterator copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    IndexIterator& operator--() noexcept {
+        index_--;
+        return *this;
+    }
+
+    IndexIterator operator--(int) noexcept {
+        IndexIterator copy = *this;
+        --(*this);
+        return copy;
+    }
+
+    bool operator==(const IndexIterator& other) const noexcept {
+        return (container_ == other.container_) && (index_ == other.index_);
+    }
+
+    bool operator!=(const IndexIterator& other) const noexcept {
+        return !(*this == other);
+    }
+
+    reference operator*() const {
+        return Access{}(*container_, index_);
+    }
+
+    pointer operator->() const {
+        if constexpr (std::is_lvalue_reference_v<Reference>) {
+            return std::addressof(**this);
+        } else {
+            return ArrowProxy{**this};
+        }
+    }
+
+    IndexIterator& operator+= (difference_type index) {
+        index_ += index;
+        return *this;
+    }
+
+    IndexIterator& operator-= (difference_type index) {
+        index_ -= index;
+        return *this;
+    }
+
+    IndexIterator operator+ (difference_type index) const {
+        IndexIterator copy(*this);
+        copy.index_ += index;
+        return copy;
+    }
+
+    friend IndexIterator operator+ (difference_type index, const IndexIterator& iter) {
+        return iter + index;
+    }
+
+    IndexIterator operator- (difference_type index) const {
+        IndexIterator copy(*this);
+        copy.index_ -= index;
+        return copy;
+    }
+
+    difference_type operator- (const IndexIterator& iter) const {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(iter.index_);
+    }
+
+    reference operator[](difference_type i) const {
+        return Access{}(*container_, index_ + i);
+    }
+
+    bool operator<(const IndexIterator& iter) const {
+        return index_ < iter.index_;
+    }
+
+    bool operator>=(const IndexIterator& iter) const {
+        return !(*this < iter);
+    }
+
+    bool operator>(const IndexIterator& iter) const {
+        return iter < (*this);
+    }
+
+    bool operator<=(const IndexIterator& iter) const {
+        return index_ <= iter.index_;
+    }
+};
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#pragma once
+
+struct ParallelPolicy {
+    size_t threads = 0;
+    size_t min_chunk = size_t(1) << 16;
+    bool pin_threads = false;
+};
+
+inline size_t parallel_threads(size_t count, const ParallelPolicy& policy) {
+    size_t threads = policy.threads ? policy.threads : std::max(1u, std::thread::hardware_concurrency());
+    size_t min_chunk = std::max<size_t>(policy.min_chunk, 1);
+    return std::max<size_t>(1, std::min(threads, count / min_chunk));
+}
+
+inline void pin_current_thread(size_t index) {
+#ifdef __linux__
+    const size_t cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)index;
+#endif
+}
+
+template <size_t Granularity = 1, typename Func>
+void parallel_for(size_t count, const ParallelPolicy& policy, Func&& func) {
+    const size_t threads = parallel_threads(count, policy);
+    if (threads == 1) {
+        func(size_t(0), count);
+        return;
+    }
+    size_t chunk = (count + threads - 1) / threads;
+    chunk = (chunk + Granularity - 1) / Granularity * Granularity;
+
+    std::vector<std::jthread> team;
+    team.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        const size_t first = std::min(count, i * chunk);
+        const size_t last = std::min(count, first + chunk);
+        if (first == last) {
+            break;
+        }
+        team.emplace_back([&func, &policy, i, first, last] {
+            if (policy.pin_threads) {
+                pin_current_thread(i);
+            }
+            func(first, last);
+        });
+    }
+}
+
+inline constexpr size_t parallel_page_bytes = 4096;
+
+template <typename T, typename Func>
+void parallel_for_pages(T* data, size_t first, size_t last, const ParallelPolicy& policy, Func&& func) {
+    if (first >= last) {
+        return;
+    }
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(data + first);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(data + last);
+    const uintptr_t first_page = begin / parallel_page_bytes;
+    const size_t pages = (end - 1) / parallel_page_bytes - first_page + 1;
+    auto page_start = [&](size_t page) {
+        if (page == 0) {
+            return first;
+        }
+        const uintptr_t boundary = (first_page + page) * parallel_page_bytes;
+        return std::min(last, first + (boundary - begin + sizeof(T) - 1) / sizeof(T));
+    };
+
+    ParallelPolicy page_policy = policy;
+    page_policy.min_chunk = std::max<size_t>(1, policy.min_chunk * sizeof(T) / parallel_page_bytes);
+    parallel_for(pages, page_policy, [&](size_t first_chunk_page, size_t last_chunk_page) {
+        func(page_start(first_chunk_page), page_start(last_chunk_page));
+    });
+}
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "vector.hpp"
+#pragma once
+
+template<typename T>
+concept RadixSortable = (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+inline constexpr size_t radix_sort_threshold = 256;
+
+template<RadixSortable T>
+auto radix_key(T value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        constexpr Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        Bits bits = std::bit_cast<Bits>(value);
+        return (bits & sign) ? Bits(~bits) : Bits(bits | sign);
+    } else if constexpr (std::is_signed_v<T>) {
+        using Bits = std::make_unsigned_t<T>;
+        constexpr Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        return Bits(static_cast<Bits>(value) ^ sign);
+    } else {
+        return value;
+    }
+}
+
+template<typename T, typename V>
+bool radix_sort_passes(T* src, T* dst, V* values, V* values_dst, size_t count) {
+    constexpr size_t digits = sizeof(radix_key(T{}));
+    std::array<std::array<size_t, 256>, digits> histograms{};
+    for (size_t i = 0; i < count; ++i) {
+        auto key = radix_key(src[i]);
+        for (size_t d = 0; d < digits; ++d) {
+            histograms[d][(key >> (8 * d)) & 0xff]++;
+        }
+    }
+
+    bool swapped = false;
+    for (size_t d = 0; d < digits; ++d) {
+        auto& histogram = histograms[d];
+        if (histogram[(radix_key(src[0]) >> (8 * d)) & 0xff] == count) {
+            continue;
+        }
+        size_t offset = 0;
+        for (auto& bucket : histogram) {
+            size_t bucket_size = bucket;
+            bucket = offset;
+            offset += bucket_size;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            size_t pos = histogram[(radix_key(src[i]) >> (8 * d)) & 0xff]++;
+            dst[pos] = src[i];
+            if constexpr (!std::is_void_v<V>) {
+                values_dst[pos] = std::move(values[i]);
+            }
+        }
+        std::swap(src, dst);
+        std::swap(values, values_dst);
+        swapped = !swapped;
+    }
+    return swapped;
+}
+
+template<RadixSortable T, typename Allocator>
+void radix_sort(Vector<T, Allocator>& vec, Vector<T, Allocator>& scratch) {
+    const size_t count = vec.size();
+    if (count < radix_sort_threshold) {
+        std::sort(vec.data(), vec.data() + count);
+        return;
+    }
+    if (scratch.size() < count) {
+        scratch.resize(count);
+    }
+    if (radix_sort_passes<T, void>(vec.data(), scratch.data(), nullptr, nullptr, count)) {
+        if (scratch.size() == count) {
+            vec.swap(scratch);
+        } else {
+            std::copy(scratch.data(), scratch.data() + count, vec.data());
+        }
+    }
+}
+
+template<RadixSortable T, typename Allocator>
+void radix_sort(Vector<T, Allocator>& vec) {
+    Vector<T, Allocator> scratch(vec.get_allocator());
+    radix_sort(vec, scratch);
+}
+
+template<RadixSortable K, typename V, typename KeyAllocator, typename ValueAllocator>
+void radix_sort_by_key(Vector<K, KeyAllocator>& keys, Vector<V, ValueAllocator>& values) {
+    const size_t count = keys.size();
+    if (values.size() != count) {
+        throw std::invalid_argument("radix_sort_by_key: keys and values differ in size");
+    }
+    if (count < radix_sort_threshold) {
+        for (size_t i = 1; i < count; ++i) {
+            for (size_t j = i; j > 0 && radix_key(keys[j]) < radix_key(keys[j - 1]); --j) {
+                std::swap(keys[j], keys[j - 1]);
+                std::swap(values[j], values[j - 1]);
+            }
+        }
+        return;
+    }
+    Vector<K, KeyAllocator> key_scratch(keys.get_allocator());
+    Vector<V, ValueAllocator> value_scratch(values.get_allocator());
+    key_scratch.resize(count);
+    value_scratch.resize(count);
+    if (radix_sort_passes(keys.data(), key_scratch.data(), values.data(), value_scratch.data(), count)) {
+        keys.swap(key_scratch);
+        values.swap(value_scratch);
+    }
+}
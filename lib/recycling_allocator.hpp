@@ -0,0 +1,164 @@
+#include <bit>
+#include <cstddef>
+#include <new>
+#pragma once
+
+struct RecyclingStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t recycled = 0;
+    size_t evicted = 0;
+    size_t cached_bytes = 0;
+};
+
+class RecyclingPool {
+    struct Node {
+        Node* next;
+    };
+
+    static constexpr size_t buckets_ = 64;
+    static constexpr size_t alignment_ = alignof(std::max_align_t);
+    static constexpr size_t min_bucket_ = std::bit_width(sizeof(Node) - 1);
+
+    Node* free_[buckets_] = {};
+    size_t max_cached_bytes_ = size_t(64) << 20;
+    RecyclingStats stats_;
+
+    static size_t bucket(size_t bytes) noexcept {
+        size_t index = std::bit_width(bytes - 1);
+        return (index < min_bucket_) ? min_bucket_ : index;
+    }
+
+    void release(size_t index) noexcept {
+        while (free_[index]) {
+            Node* node = free_[index];
+            free_[index] = node->next;
+            stats_.cached_bytes -= size_t(1) << index;
+            ::operator delete(node, std::align_val_t(alignment_));
+        }
+    }
+
+public:
+    RecyclingPool() = default;
+    RecyclingPool(const RecyclingPool&) = delete;
+    RecyclingPool& operator=(const RecyclingPool&) = delete;
+
+    ~RecyclingPool() {
+        trim();
+    }
+
+    static bool& local_destroyed() noexcept {
+        thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static RecyclingPool& local() {
+        struct LocalPool : RecyclingPool {
+            ~LocalPool() {
+                local_destroyed() = true;
+            }
+        };
+        thread_local LocalPool pool;
+        return pool;
+    }
+
+    static void* local_allocate(size_t bytes) {
+        if (local_destroyed()) {
+            return ::operator new(bytes == 0 ? 1 : bytes, std::align_val_t(alignment_));
+        }
+        return local().allocate(bytes);
+    }
+
+    static void local_deallocate(void* ptr, size_t bytes) noexcept {
+        if (local_destroyed()) {
+            ::operator delete(ptr, std::align_val_t(alignment_));
+            return;
+        }
+        local().deallocate(ptr, bytes);
+    }
+
+    void* allocate(size_t bytes) {
+        const size_t index = bucket(bytes == 0 ? 1 : bytes);
+        if (Node* node = free_[index]) {
+            free_[index] = node->next;
+            stats_.hits++;
+            stats_.cached_bytes -= size_t(1) << index;
+            return node;
+        }
+        stats_.misses++;
+        return ::operator new(size_t(1) << index, std::align_val_t(alignment_));
+    }
+
+    void deallocate(void* ptr, size_t bytes) noexcept {
+        if (!ptr) {
+            return;
+        }
+        const size_t index = bucket(bytes == 0 ? 1 : bytes);
+        const size_t size = size_t(1) << index;
+        if (stats_.cached_bytes + size > max_cached_bytes_) {
+            stats_.evicted++;
+            ::operator delete(ptr, std::align_val_t(alignment_));
+            return;
+        }
+        Node* node = ::new (ptr) Node{free_[index]};
+        free_[index] = node;
+        stats_.recycled++;
+        stats_.cached_bytes += size;
+    }
+
+    void trim() noexcept {
+        for (size_t i = 0; i < buckets_; ++i) {
+            release(i);
+        }
+    }
+
+    void set_max_cached_bytes(size_t bytes) noexcept {
+        max_cached_bytes_ = bytes;
+        if (stats_.cached_bytes > max_cached_bytes_) {
+            trim();
+        }
+    }
+
+    size_t max_cached_bytes() const noexcept {
+        return max_cached_bytes_;
+    }
+
+    const RecyclingStats& stats() const noexcept {
+        return stats_;
+    }
+
+    void reset_stats() noexcept {
+        size_t cached_bytes = stats_.cached_bytes;
+        stats_ = RecyclingStats{};
+        stats_.cached_bytes = cached_bytes;
+    }
+
+    static constexpr size_t alignment() noexcept {
+        return alignment_;
+    }
+};
+
+template<typename T>
+class RecyclingAllocator {
+    static_assert(alignof(T) <= RecyclingPool::alignment(), "RecyclingAllocator does not support over-aligned types");
+public:
+    using value_type = T;
+
+    RecyclingAllocator() noexcept = default;
+
+    template<typename U>
+    RecyclingAllocator(const RecyclingAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(RecyclingPool::local_allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        RecyclingPool::local_deallocate(ptr, count * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const RecyclingAllocator<U>&) const noexcept {
+        return true;
+    }
+};
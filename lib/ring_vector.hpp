@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <span>
+#include <utility>
+#include <iterator>
+#include "index_iterator.hpp"
+#pragma once
+
+template<typename T, typename Allocator = std::allocator<T>>
+class RingVector {
+    Allocator alloc_;
+    T* data_ = nullptr;
+
+    size_t head_ = 0;
+    size_t real_size_ = 0;
+    size_t capacity_ = 0;
+
+    size_t slot(size_t index) const noexcept {
+        return (head_ + index) & (capacity_ - 1);
+    }
+
+    void reallocate(size_t new_capacity) {
+        T* new_massive = std::allocator_traits<Allocator>::allocate(alloc_, new_capacity);
+        for (size_t i = 0; i < real_size_; ++i) {
+            std::allocator_traits<Allocator>::construct(alloc_, new_massive + i, std::move_if_noexcept(data_[slot(i)]));
+        }
+        for (size_t i = 0; i < real_size_; ++i) {
+            std::allocator_traits<Allocator>::destroy(alloc_, data_ + slot(i));
+        }
+        if (data_) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+        }
+        data_ = new_massive;
+        head_ = 0;
+        capacity_ = new_capacity;
+    }
+
+    void allocate() {
+        reallocate((capacity_ == 0) ? 1 : capacity_ * 2);
+    }
+
+public:
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = size_t;
+
+    using iterator = IndexIterator<RingVector, T&>;
+    using const_iterator = IndexIterator<const RingVector, const T&>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RingVector() {};
+
+    constexpr explicit RingVector(const Allocator& alloc) noexcept : alloc_(alloc) {};
+
+    RingVector(std::initializer_list<T> ilist, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        reserve(ilist.size());
+        for (const auto& i : ilist) {
+            push_back(i);
+        }
+    }
+
+    RingVector(const RingVector& ring) : alloc_(ring.alloc_) {
+        reserve(ring.size());
+        for (size_t i = 0; i < ring.size(); i++) {
+            push_back(ring[i]);
+        }
+    }
+
+    RingVector(RingVector&& ring) noexcept : alloc_(std::move(ring.alloc_)), data_(ring.data_),
+        head_(ring.head_), real_size_(ring.real_size_), capacity_(ring.capacity_) {
+        ring.data_ = nullptr;
+        ring.head_ = 0;
+        ring.real_size_ = 0;
+        ring.capacity_ = 0;
+    }
+
+    ~RingVector() {
+        clear();
+        if (data_) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+        }
+    }
+
+    void swap(RingVector& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(data_, other.data_);
+        std::swap(head_, other.head_);
+        std::swap(real_size_, other.real_size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    RingVector& operator=(const RingVector& ring) {
+        RingVector copy(ring);
+        swap(copy);
+        return *this;
+    }
+
+    RingVector& operator=(RingVector&& ring) noexcept {
+        RingVector copy(std::move(ring));
+        swap(copy);
+        return *this;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        if (real_size_ == capacity_) {
+            allocate();
+        }
+        std::allocator_traits<Allocator>::construct(alloc_, data_ + slot(real_size_), std::forward<Args>(args)...);
+        real_size_++;
+    }
+
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        if (real_size_ == capacity_) {
+            allocate();
+        }
+        size_t new_head = (head_ - 1) & (capacity_ - 1);
+        std::allocator_traits<Allocator>::construct(alloc_, data_ + new_head, std::forward<Args>(args)...);
+        head_ = new_head;
+        real_size_++;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    void pop_back() noexcept {
+        if (real_size_ == 0) {
+            return;
+        }
+        real_size_--;
+        std::allocator_traits<Allocator>::destroy(alloc_, data_ + slot(real_size_));
+    }
+
+    void pop_front() noexcept {
+        if (real_size_ == 0) {
+            return;
+        }
+        std::allocator_traits<Allocator>::destroy(alloc_, data_ + head_);
+        head_ = (head_ + 1) & (capacity_ - 1);
+        real_size_--;
+    }
+
+    reference operator[] (size_t index) {
+        return data_[slot(index)];
+    }
+
+    const_reference operator[] (size_t index) const {
+        return data_[slot(index)];
+    }
+
+    reference at(size_t index) {
+        return data_[slot(index)];
+    }
+
+    const_reference at(size_t index) const {
+        return data_[slot(index)];
+    }
+
+    reference front() {
+        return data_[head_];
+    }
+
+    const_reference front() const {
+        return data_[head_];
+    }
+
+    reference back() {
+        return data_[slot(real_size_ - 1)];
+    }
+
+    const_reference back() const {
+        return data_[slot(real_size_ - 1)];
+    }
+
+    size_t size() const {
+        return real_size_;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return (real_size_ == 0);
+    }
+
+    void clear() noexcept {
+        while (!empty()) {
+            pop_back();
+        }
+        head_ = 0;
+    }
+
+    void reserve(size_t size) {
+        if (size > capacity_) {
+            reallocate(std::bit_ceil(size));
+        }
+    }
+
+    constexpr Allocator get_allocator() const {
+        return alloc_;
+    }
+
+    std::pair<std::span<T>, std::span<T>> as_spans() noexcept {
+        if (real_size_ == 0) {
+            return {};
+        }
+        size_t first = std::min(real_size_, capacity_ - head_);
+        return {std::span<T>(data_ + head_, first), std::span<T>(data_, real_size_ - first)};
+    }
+
+    std::pair<std::span<const T>, std::span<const T>> as_spans() const noexcept {
+        if (real_size_ == 0) {
+            return {};
+        }
+        size_t first = std::min(real_size_, capacity_ - head_);
+        return {std::span<const T>(data_ + head_, first), std::span<const T>(data_, real_size_ - first)};
+    }
+
+    iterator begin() {
+        return iterator{this, 0};
+    }
+
+    const_iterator begin() const {
+        return const_iterator{this, 0};
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator{this, 0};
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    iterator end() {
+        return iterator{this, real_size_};
+    }
+
+    const_iterator end() const {
+        return const_iterator{this, real_size_};
+    }
+
+    const_iterator cend() const {
+        return const_iterator{this, real_size_};
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+};
@@ -0,0 +1,83 @@
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include "vector.hpp"
+#pragma once
+
+template<typename T, typename Allocator = std::allocator<T>>
+class SharedVector {
+public:
+    using vector_type = Vector<T, Allocator>;
+    using snapshot_type = std::shared_ptr<const vector_type>;
+    using size_type = size_t;
+
+private:
+    struct Published {
+        vector_type vec;
+        size_type version;
+    };
+
+    std::atomic<std::shared_ptr<const Published>> current_;
+    std::optional<vector_type> draft_;
+
+public:
+    SharedVector() : current_(std::make_shared<const Published>(vector_type(), 0)) {}
+
+    explicit SharedVector(vector_type vec) : current_(std::make_shared<const Published>(std::move(vec), 0)) {}
+
+    SharedVector(const SharedVector&) = delete;
+    SharedVector& operator=(const SharedVector&) = delete;
+
+    snapshot_type snapshot() const noexcept {
+        return versioned_snapshot().first;
+    }
+
+    size_type version() const noexcept {
+        return current_.load(std::memory_order_acquire)->version;
+    }
+
+    std::pair<snapshot_type, size_type> versioned_snapshot() const noexcept {
+        std::shared_ptr<const Published> published = current_.load(std::memory_order_acquire);
+        const size_type version = published->version;
+        const vector_type* vec = &published->vec;
+        return {snapshot_type(std::move(published), vec), version};
+    }
+
+    vector_type& edit() {
+        if (!draft_) {
+            draft_.emplace(*snapshot());
+        }
+        return *draft_;
+    }
+
+    bool dirty() const noexcept {
+        return draft_.has_value();
+    }
+
+    void discard() noexcept {
+        draft_.reset();
+    }
+
+    bool publish() {
+        if (!draft_) {
+            return false;
+        }
+        const size_type version = current_.load(std::memory_order_relaxed)->version + 1;
+        auto next = std::make_shared<const Published>(std::move(*draft_), version);
+        draft_.reset();
+        current_.store(std::move(next), std::memory_order_release);
+        return true;
+    }
+
+    void publish(vector_type vec) {
+        draft_.emplace(std::move(vec));
+        publish();
+    }
+
+    template <typename Func>
+    void update(Func&& func) {
+        func(edit());
+        publish();
+    }
+};
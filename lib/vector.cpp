@@ -1 +1,11 @@
-#include "vector.hpp"
\ No newline at end of file
+#include "parallel.hpp"
+#include "vector.hpp"
+
+#ifdef VECTOR_EXTERN_TEMPLATES
+#define VECTOR_INSTANTIATE(...) \
+    template class Vector<__VA_ARGS__>; \
+    template class Vector<__VA_ARGS__>::Iterator<true>; \
+    template class Vector<__VA_ARGS__>::Iterator<false>;
+#include "vector_instantiations.hpp"
+#undef VECTOR_INSTANTIATE
+#endif
@@ -2,6 +2,14 @@
 #include <memory>
 #include <vector>
 #include <concepts>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include "vector_fwd.hpp"
 #pragma once
 
 template<typename T>
@@ -9,13 +17,89 @@ concept Dereferenceable = requires(T t) {
     { *t } -> std::convertible_to<std::iter_reference_t<T>>;
 };
 
-template<typename T, typename Allocator = std::allocator<T>>
+template<typename T>
+concept BytewiseComparable = (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+    std::has_unique_object_representations_v<T>;
+
+template<typename E>
+concept VectorExpression = requires(const E& expr, size_t i) {
+    typename E::expression_tag;
+    { expr.size() } -> std::convertible_to<size_t>;
+    expr[i];
+};
+
+template<typename T, typename Allocator>
 class Vector {
-    Allocator alloc_;
+    [[no_unique_address]] Allocator alloc_;
     T* data_ = nullptr;
 
     size_t real_size_ = 0;
     size_t capacity_ = 0;
+
+    static constexpr size_t line_elements_ = std::max<size_t>(1, 64 / sizeof(T));
+
+    void prepare_overwrite(size_t count) {
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>) {
+            resize_for_overwrite(count);
+        } else {
+            resize(count);
+        }
+    }
+
+    template<typename Expr>
+    void evaluate(const Expr& expr, size_t first, size_t last) {
+        T* out = data_;
+        size_t i = first;
+        for (; i + line_elements_ <= last; i += line_elements_) {
+#pragma GCC ivdep
+            for (size_t j = 0; j < line_elements_; ++j) {
+                out[i + j] = static_cast<T>(expr[i + j]);
+            }
+        }
+        for (; i < last; ++i) {
+            out[i] = static_cast<T>(expr[i]);
+        }
+    }
+
+    void construct_parallel(size_t first, size_t last, const T& value, const ParallelPolicy& policy) {
+        if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+            parallel_for_pages(data_, first, last, policy, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    std::allocator_traits<Allocator>::construct(alloc_, data_ + i, value);
+                }
+            });
+        } else {
+            for (size_t i = first; i < last; ++i) {
+                std::allocator_traits<Allocator>::construct(alloc_, data_ + i, value);
+            }
+        }
+    }
+    void grow(size_t size) {
+        if (size > capacity_) {
+            reserve(std::max(size, capacity_ * 2));
+        }
+    }
+
+    template <typename Iter, typename Sentinel>
+    void append_chunks(Iter first, Sentinel last) {
+        while (first != last) {
+            if (real_size_ == capacity_) {
+                grow(std::max<size_t>(real_size_ + 16, capacity_ * 2));
+            }
+            T* out = data_ + real_size_;
+            const size_t room = capacity_ - real_size_;
+            size_t written = 0;
+            try {
+                for (; written < room && first != last; ++first, ++written) {
+                    std::allocator_traits<Allocator>::construct(alloc_, out + written, *first);
+                }
+            } catch (...) {
+                real_size_ += written;
+                throw;
+            }
+            real_size_ += written;
+        }
+    }
 public:
     using reference = T&;
     using const_reference = const T&;
@@ -27,7 +111,6 @@ public:
 
     template <bool IsMutable = true>
     class Iterator {
-        friend Iterator operator+ (difference_type index, const Iterator& that);
         T* massive_ = nullptr;
     public:
         size_type index_ = 0;   
@@ -163,6 +246,10 @@ public:
         }
     }
 
+    Vector(size_t count, const T& value, const ParallelPolicy& policy, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        assign(count, value, policy);
+    }
+
     void swap(Vector& other) noexcept {
         std::swap(alloc_, other.alloc_);
         std::swap(data_, other.data_);
@@ -200,6 +287,18 @@ public:
         (*this) = ilist;
     }
 
+    template<VectorExpression Expr>
+    Vector(const Expr& expr, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        assign(expr);
+    }
+
+    ~Vector() {
+        clear();
+        if (data_) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+        }
+    }
+
     Vector& operator=(const Vector& vec) noexcept {
 		Vector copy(vec);
         swap(copy);
@@ -218,6 +317,12 @@ public:
         return *this;
     }
 
+    template<VectorExpression Expr>
+    Vector& operator=(const Expr& expr) {
+        assign(expr);
+        return *this;
+    }
+
     void allocate() {
         size_t new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2; 
         T* new_massive = std::allocator_traits<Allocator>::allocate(alloc_, new_capacity);
@@ -300,11 +405,7 @@ public:
 
     template<Dereferenceable InputIt>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
-        while (first != last) {
-            pos = insert(pos, *first);
-            first++;
-        }
-        return pos;
+        return insert(begin() + (pos - cbegin()), first, last);
     }
 
     template<Dereferenceable InputIt>
@@ -317,10 +418,7 @@ public:
     }
 
     constexpr iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
-        for (const auto& i : ilist) {
-            pos = insert(pos, i);
-        }
-        return pos;
+        return insert(begin() + (pos - cbegin()), ilist);
     }
 
     constexpr iterator insert(iterator pos, std::initializer_list<T> ilist) {
@@ -347,15 +445,52 @@ public:
         emplace_back(std::move(value));
     }
 
-    template <std::ranges::input_range Range>
-    constexpr void append_range(Range&& range) {
-        if constexpr (std::ranges::sized_range<Range>) {
-            reserve(real_size_ + std::ranges::size(range));
+    template <typename Generator>
+    void append_n(size_t count, Generator&& gen) {
+        grow(real_size_ + count);
+        T* out = data_ + real_size_;
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                if constexpr (std::invocable<Generator&, size_t>) {
+                    std::allocator_traits<Allocator>::construct(alloc_, out + i, gen(i));
+                } else {
+                    std::allocator_traits<Allocator>::construct(alloc_, out + i, gen());
+                }
+            }
+        } catch (...) {
+            real_size_ += i;
+            throw;
         }
-        
-        for (auto&& i : range) {
-            emplace_back(std::forward<decltype(i)>(i));
+        real_size_ += count;
+    }
+
+    template <typename... Args>
+    void emplace_back_n(size_t count, const Args&... args) {
+        grow(real_size_ + count);
+        T* out = data_ + real_size_;
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(alloc_, out + i, args...);
+            }
+        } catch (...) {
+            real_size_ += i;
+            throw;
         }
+        real_size_ += count;
+    }
+
+    template <std::ranges::input_range Range>
+        requires std::ranges::sized_range<Range>
+    constexpr void append_range(Range&& range) {
+        grow(real_size_ + std::ranges::size(range));
+        append_chunks(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    template <std::ranges::input_range Range>
+    constexpr void append_range(Range&& range) {
+        append_chunks(std::ranges::begin(range), std::ranges::end(range));
     }
 
     template <std::ranges::input_range Range>
@@ -424,12 +559,8 @@ public:
         if (real_size_ == 0) {
             return;
         }
-        std::allocator_traits<Allocator>::destroy(alloc_, data_ + real_size_);
-        if (real_size_ == 0) {
-            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
-            return;
-        }
         real_size_--;
+        std::allocator_traits<Allocator>::destroy(alloc_, data_ + real_size_);
     }
 
     reference operator[] (size_t index) {
@@ -497,6 +628,43 @@ public:
         }
     }
 
+    void assign(size_t count, const T& value, const ParallelPolicy& policy) {
+        clear();
+        if (count > capacity_) {
+            reserve(count);
+        }
+        construct_parallel(0, count, value, policy);
+        real_size_ = count;
+    }
+
+    template<VectorExpression Expr>
+    void assign(const Expr& expr) {
+        prepare_overwrite(expr.size());
+        evaluate(expr, 0, expr.size());
+    }
+
+    template<VectorExpression Expr>
+    void assign(const Expr& expr, const ParallelPolicy& policy) {
+        prepare_overwrite(expr.size());
+        parallel_for<line_elements_>(expr.size(), policy, [&](size_t first, size_t last) {
+            evaluate(expr, first, last);
+        });
+    }
+
+    void fill(const T& value) {
+        std::fill(data_, data_ + real_size_, value);
+    }
+
+    void fill(const T& value, const ParallelPolicy& policy) {
+        if constexpr (std::is_nothrow_copy_assignable_v<T>) {
+            parallel_for_pages(data_, size_t(0), real_size_, policy, [&](size_t first, size_t last) {
+                std::fill(data_ + first, data_ + last, value);
+            });
+        } else {
+            fill(value);
+        }
+    }
+
     constexpr Allocator get_allocator() const {
         return alloc_;
     }
@@ -514,6 +682,26 @@ public:
         real_size_ = size;
     }
 
+    void resize(size_type size, const T& value, const ParallelPolicy& policy) {
+        if (size <= real_size_) {
+            resize(size, value);
+            return;
+        }
+        if (size > capacity_) {
+            reserve(size);
+        }
+        construct_parallel(real_size_, size, value, policy);
+        real_size_ = size;
+    }
+
+    void resize_for_overwrite(size_type size)
+        requires std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T> {
+        if (size > capacity_) {
+            reserve(size);
+        }
+        real_size_ = size;
+    }
+
     constexpr void reserve(size_t size) {
         T* new_massive = std::allocator_traits<Allocator>::allocate(alloc_, size);
         for (size_t i = 0; i < real_size_; ++i) {
@@ -531,6 +719,19 @@ public:
         return capacity_;
     }
 
+    void shrink_to_fit() {
+        if (real_size_ == capacity_) {
+            return;
+        }
+        if (real_size_ == 0) {
+            std::allocator_traits<Allocator>::deallocate(alloc_, data_, capacity_);
+            data_ = nullptr;
+            capacity_ = 0;
+            return;
+        }
+        reserve(real_size_);
+    }
+
     constexpr void assign(std::initializer_list<T> ilist) {
         clear();
         for (const auto& i : ilist) {
@@ -594,3 +795,67 @@ std::ostream& operator<<(std::ostream& os, const Vector<T>& vec) {
     }
     return os;
 }
+
+template<typename T, typename Allocator>
+bool operator==(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    if (lhs.empty()) {
+        return true;
+    }
+    if constexpr (BytewiseComparable<T>) {
+        return std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+    } else {
+        return std::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+    }
+}
+
+template<typename T, typename Allocator>
+auto operator<=>(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs) {
+    if constexpr (BytewiseComparable<T> && std::is_integral_v<T>) {
+        const size_t count = std::min(lhs.size(), rhs.size());
+        constexpr size_t block = 64 / sizeof(T);
+        size_t i = 0;
+        while (i + block <= count && std::memcmp(lhs.data() + i, rhs.data() + i, block * sizeof(T)) == 0) {
+            i += block;
+        }
+        while (i < count && lhs[i] == rhs[i]) {
+            i++;
+        }
+        if (i < count) {
+            return lhs[i] <=> rhs[i];
+        }
+        return lhs.size() <=> rhs.size();
+    } else {
+        return std::lexicographical_compare_three_way(
+            lhs.data(), lhs.data() + lhs.size(),
+            rhs.data(), rhs.data() + rhs.size()
+        );
+    }
+}
+
+template<typename T, typename Allocator>
+struct std::hash<Vector<T, Allocator>> {
+    size_t operator()(const Vector<T, Allocator>& vec) const noexcept {
+        if constexpr (BytewiseComparable<T>) {
+            std::string_view bytes(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(T));
+            return std::hash<std::string_view>{}(bytes);
+        } else {
+            size_t seed = vec.size();
+            for (size_t i = 0; i < vec.size(); i++) {
+                seed ^= std::hash<T>{}(vec[i]) + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+    }
+};
+
+#ifdef VECTOR_EXTERN_TEMPLATES
+#define VECTOR_INSTANTIATE(...) \
+    extern template class Vector<__VA_ARGS__>; \
+    extern template class Vector<__VA_ARGS__>::Iterator<true>; \
+    extern template class Vector<__VA_ARGS__>::Iterator<false>;
+#include "vector_instantiations.hpp"
+#undef VECTOR_INSTANTIATE
+#endif
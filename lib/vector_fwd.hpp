@@ -0,0 +1,14 @@
+#include <cstddef>
+#include <memory>
+#pragma once
+
+template<typename T, typename Allocator = std::allocator<T>>
+class Vector;
+
+struct ParallelPolicy;
+
+template<size_t Granularity, typename Func>
+void parallel_for(size_t count, const ParallelPolicy& policy, Func&& func);
+
+template<typename T, typename Func>
+void parallel_for_pages(T* data, size_t first, size_t last, const ParallelPolicy& policy, Func&& func);
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+# Builds Vector consumers with and without explicit instantiation of Vector
+# and reports compile time and object sizes. Extra arguments go to cmake.
+#
+# COMPARE_TARGETS picks the timed targets. The default covers every target
+# that builds with GCC 12. The tests target needs a standard library with
+# std::vector::append_range (libstdc++ 14 or libc++ 18); use
+# COMPARE_TARGETS="tests" there. COMPARE_BUILD_DIR defaults to a
+# directory under $TMPDIR, outside the source tree.
+set -euo pipefail
+
+root="$(cd "$(dirname "$0")/.." && pwd)"
+work="${COMPARE_BUILD_DIR:-${TMPDIR:-/tmp}/vector-compare-build}"
+jobs="${JOBS:-$(nproc)}"
+read -r -a targets <<< "${COMPARE_TARGETS:-vector gather_bench perf_bench}"
+
+printf "%-22s %10s %14s\n" "mode" "seconds" "objects bytes"
+for mode in ON OFF; do
+    dir="$work/instantiation-$mode"
+    cmake -S "$root" -B "$dir" -DVECTOR_EXPLICIT_INSTANTIATION="$mode" "$@" > /dev/null
+    cmake --build "$dir" --target clean > /dev/null
+    if [[ " ${targets[*]} " == *" tests "* ]]; then
+        cmake --build "$dir" --target gtest_main -j"$jobs" > /dev/null
+    fi
+
+    start=$(date +%s.%N)
+    cmake --build "$dir" --target "${targets[@]}" -j"$jobs" > /dev/null
+    end=$(date +%s.%N)
+
+    objects_bytes=$(find "$dir/lib" "$dir/bin" "$dir/bench" "$dir/tests" -name '*.o' -exec stat -c %s {} + 2> /dev/null |
+        awk '{ s += $1 } END { print s }')
+    printf "%-22s %10.2f %14s\n" "instantiation=$mode" "$(awk "BEGIN { print $end - $start }")" "$objects_bytes"
+done
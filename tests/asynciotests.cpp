@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include "lib/async_io.hpp"
+
+class AsyncIoTest : public ::testing::TestWithParam<bool> {
+protected:
+    int fd_ = -1;
+
+    void SetUp() override {
+        char path[] = "/tmp/vector_async_io_XXXXXX";
+        fd_ = mkstemp(path);
+        ASSERT_GE(fd_, 0);
+        unlink(path);
+    }
+
+    void TearDown() override {
+        close(fd_);
+    }
+
+    AsyncIoOptions Options() const {
+        AsyncIoOptions options;
+        options.chunk_bytes = 4096;
+        options.queue_depth = 4;
+        options.use_io_uring = GetParam();
+        return options;
+    }
+};
+
+TEST_P(AsyncIoTest, WriteReadTest) {
+    Vector<uint64_t> my_vec;
+    my_vec.append_n(100000, [](size_t i) { return i * 2654435761u; });
+
+    ASSERT_EQ(async_write(fd_, my_vec, 0, Options()).get(), my_vec.size());
+
+    Vector<uint64_t> loaded;
+    ASSERT_EQ(async_read(fd_, loaded, my_vec.size(), 0, Options()).get(), my_vec.size());
+    ASSERT_TRUE(loaded == my_vec);
+}
+
+TEST_P(AsyncIoTest, InOrderChunksTest) {
+    Vector<uint32_t> my_vec;
+    my_vec.append_n(50000, [](size_t i) { return static_cast<uint32_t>(i); });
+    async_write(fd_, my_vec, 0, Options()).get();
+
+    Vector<uint32_t> loaded;
+    size_t expected_first = 0;
+    bool consistent = true;
+    auto future = async_read(fd_, loaded, my_vec.size(), 0, Options(), [&](size_t first, size_t last) {
+        consistent = consistent && first == expected_first && last > first;
+        for (size_t i = first; i < last; ++i) {
+            consistent = consistent && loaded.data()[i] == i;
+        }
+        expected_first = last;
+    });
+
+    ASSERT_EQ(future.get(), my_vec.size());
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(expected_first, my_vec.size());
+}
+
+TEST_P(AsyncIoTest, ShortFileTest) {
+    Vector<uint16_t> my_vec;
+    my_vec.append_n(10001, [](size_t i) { return static_cast<uint16_t>(i); });
+    async_write(fd_, my_vec, 0, Options()).get();
+
+    Vector<uint16_t> loaded;
+    ASSERT_EQ(async_read(fd_, loaded, 30000, 0, Options()).get(), my_vec.size());
+    ASSERT_TRUE(loaded == my_vec);
+}
+
+TEST_P(AsyncIoTest, OffsetTest) {
+    Vector<int> my_vec({1, 2, 3, 4, 5});
+    async_write(fd_, my_vec, 0, Options()).get();
+
+    Vector<int> loaded;
+    ASSERT_EQ(async_read(fd_, loaded, 2, 2 * sizeof(int), Options()).get(), 2);
+    ASSERT_TRUE(loaded == Vector<int>({3, 4}));
+}
+
+TEST_P(AsyncIoTest, ErrorTest) {
+    Vector<int> loaded;
+    ASSERT_THROW(async_read(-1, loaded, 10, 0, Options()).get(), std::system_error);
+    ASSERT_EQ(loaded.size(), 0);
+    try {
+        async_read(-1, loaded, 10, 0, Options()).get();
+    } catch (const std::system_error& error) {
+        ASSERT_EQ(error.code().value(), EBADF);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, AsyncIoTest, ::testing::Values(true, false));
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "lib/compact_vector.hpp"
+
+TEST(CompactVectorTest, SizeofTest) {
+    ASSERT_EQ(sizeof(CompactVector<uint32_t>), sizeof(void*));
+    ASSERT_EQ(sizeof(CompactVector<std::string, uint16_t>), sizeof(void*));
+    ASSERT_EQ(sizeof(Vector<uint32_t>), sizeof(void*) + 2 * sizeof(size_t));
+    ASSERT_LT(sizeof(CompactVector<uint32_t>), sizeof(Vector<uint32_t>));
+}
+
+TEST(CompactVectorTest, PushBackTest) {
+    CompactVector<uint32_t> my_vec;
+    std::vector<uint32_t> std_vec;
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        my_vec.push_back(i * 3);
+        std_vec.push_back(i * 3);
+    }
+    my_vec.pop_back();
+    std_vec.pop_back();
+
+    ASSERT_EQ(my_vec.size(), std_vec.size());
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(CompactVectorTest, StringTest) {
+    CompactVector<std::string, uint8_t> my_vec = {"a", "b", "c"};
+    std::vector<std::string> std_vec = {"a", "b", "c"};
+
+    CompactVector<std::string, uint8_t> copy(my_vec);
+    copy.push_back("d");
+    my_vec.resize(5, "e");
+    std_vec.resize(5, "e");
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+    ASSERT_EQ(copy.size(), 4);
+    ASSERT_EQ(copy.back(), "d");
+}
+
+TEST(CompactVectorTest, CapacityLimitTest) {
+    CompactVector<uint8_t, uint8_t> my_vec;
+
+    for (int i = 0; i < 128; i++) {
+        my_vec.push_back(static_cast<uint8_t>(i));
+    }
+    ASSERT_THROW(my_vec.reserve(256), std::length_error);
+
+    my_vec.shrink_to_fit();
+    ASSERT_EQ(my_vec.capacity(), 128);
+    ASSERT_EQ(my_vec[127], 127);
+
+    my_vec.push_back(128);
+    ASSERT_EQ(my_vec.size(), 129);
+    ASSERT_EQ(my_vec.capacity(), 255);
+    for (int i = 129; i < 255; i++) {
+        my_vec.push_back(static_cast<uint8_t>(i));
+    }
+    ASSERT_EQ(my_vec.size(), 255);
+    ASSERT_EQ(my_vec[254], 254);
+    ASSERT_THROW(my_vec.push_back(0), std::length_error);
+    ASSERT_EQ(my_vec.size(), 255);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "lib/expression.hpp"
+
+TEST(ExpressionTest, FusedAssignTest) {
+    const size_t N = 1003;
+    Vector<float> b, c, d;
+    b.append_n(N, [](size_t i) { return i * 0.5f; });
+    c.append_n(N, [](size_t i) { return 3.0f - i; });
+    d.append_n(N, [](size_t i) { return i % 7 * 1.0f; });
+    const float k = 2.5f;
+    std::vector<float> std_vec(N);
+    for (size_t i = 0; i < N; ++i) {
+        std_vec[i] = b[i] * c[i] + d[i] * k;
+    }
+
+    Vector<float> a;
+    a = b * c + d * k;
+
+    ASSERT_TRUE(std::equal(
+        a.begin(), a.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ExpressionTest, OperatorsTest) {
+    Vector<int> a({1, 2, 3, 4});
+    Vector<int> b({4, 3, 2, 1});
+    Vector<int> my_vec((a - b) * 2 + 10 / b - -a);
+    std::vector<int> std_vec = {-3, 3, 10, 20};
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ExpressionTest, AliasingTest) {
+    Vector<double> a({1, 2, 3});
+    Vector<double> b({10, 20, 30});
+    std::vector<double> std_vec = {12, 24, 36};
+
+    a = a * 2 + b;
+
+    ASSERT_TRUE(std::equal(
+        a.begin(), a.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ExpressionTest, SizeMismatchTest) {
+    Vector<int> a({1, 2, 3});
+    Vector<int> b({1, 2});
+    Vector<int> c({7, 7});
+
+    ASSERT_THROW(c = a + b, std::invalid_argument);
+    ASSERT_EQ(c.size(), 2);
+    ASSERT_EQ(c[0], 7);
+}
+
+TEST(ExpressionTest, ParallelAssignTest) {
+    const size_t N = 100000;
+    Vector<uint64_t> a, b;
+    a.append_n(N, [](size_t i) { return i; });
+    b.append_n(N, [](size_t i) { return i * i; });
+    std::vector<uint64_t> std_vec(N);
+    for (size_t i = 0; i < N; ++i) {
+        std_vec[i] = a[i] * 3 + b[i];
+    }
+
+    Vector<uint64_t> my_vec;
+    my_vec.assign(a * 3 + b, ParallelPolicy{4, 1000});
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ExpressionTest, SumTest) {
+    const size_t N = 100003;
+    Vector<int64_t> a, b;
+    a.append_n(N, [](size_t i) { return static_cast<int64_t>(i % 100) - 50; });
+    b.append_n(N, [](size_t i) { return static_cast<int64_t>(i % 13); });
+    int64_t expected = 0;
+    for (size_t i = 0; i < N; ++i) {
+        expected += a[i] * b[i] + 1;
+    }
+
+    ASSERT_EQ(sum(a * b + 1), expected);
+    ASSERT_EQ(sum(a * b + 1, ParallelPolicy{4, 1000}), expected);
+    ASSERT_EQ(sum(a), std::accumulate(a.begin(), a.end(), int64_t(0)));
+    ASSERT_EQ(sum(Vector<int64_t>()), 0);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "lib/flat_map.hpp"
+#include "lib/flat_set.hpp"
+
+TEST(FlatMapTest, InsertFindTest) {
+    FlatMap<int, std::string> my_map;
+    std::map<int, std::string> std_map;
+
+    my_map.insert(3, "c");
+    my_map.insert(1, "a");
+    my_map[2] = "b";
+    std_map.insert({3, "c"});
+    std_map.insert({1, "a"});
+    std_map[2] = "b";
+
+    ASSERT_FALSE(my_map.insert(1, "z").second);
+    ASSERT_EQ(my_map.size(), std_map.size());
+    for (const auto& [key, value] : std_map) {
+        ASSERT_EQ(my_map.at(key), value);
+    }
+    ASSERT_FALSE(my_map.contains(4));
+    ASSERT_THROW(my_map.at(4), std::out_of_range);
+
+    my_map.find(2)->second = "bb";
+    ASSERT_EQ(my_map.find(2)->first, 2);
+    ASSERT_EQ(my_map.at(2), "bb");
+    ASSERT_EQ(my_map.end() - my_map.begin(), 3);
+}
+
+struct ThrowingValue {
+    int value = 0;
+
+    ThrowingValue(int v) : value(v) {
+        if (v < 0) {
+            throw std::runtime_error("negative");
+        }
+    }
+};
+
+TEST(FlatMapTest, ThrowingValueTest) {
+    FlatMap<int, ThrowingValue> my_map;
+    my_map.insert(1, ThrowingValue(10));
+    my_map.insert(3, ThrowingValue(30));
+
+    ASSERT_THROW(my_map.try_emplace(2, -1), std::runtime_error);
+    ASSERT_EQ(my_map.size(), 2);
+    ASSERT_EQ(my_map.keys().size(), my_map.values().size());
+    ASSERT_FALSE(my_map.contains(2));
+    ASSERT_EQ(my_map.at(1).value, 10);
+    ASSERT_EQ(my_map.at(3).value, 30);
+
+    std::vector<std::pair<int, int>> batch = {{5, 50}, {4, -1}, {6, 60}};
+    ASSERT_THROW(my_map.insert_batch(batch), std::runtime_error);
+    ASSERT_EQ(my_map.size(), 2);
+    ASSERT_EQ(my_map.keys().size(), my_map.values().size());
+    ASSERT_EQ(my_map.at(3).value, 30);
+}
+
+TEST(FlatMapTest, EraseTest) {
+    FlatMap<int, int> my_map = {{1, 10}, {2, 20}, {3, 30}};
+    std::map<int, int> std_map = {{1, 10}, {2, 20}, {3, 30}};
+
+    ASSERT_TRUE(my_map.erase(2));
+    ASSERT_FALSE(my_map.erase(2));
+    std_map.erase(2);
+
+    ASSERT_TRUE(std::equal(
+        my_map.keys().begin(), my_map.keys().end(),
+        std_map.begin(), std_map.end(),
+        [](int key, const auto& pair) { return key == pair.first; }
+    ));
+}
+
+TEST(FlatMapTest, InsertBatchTest) {
+    FlatMap<int, int> my_map = {{5, 0}, {1, 0}, {9, 0}};
+    std::map<int, int> std_map = {{5, 0}, {1, 0}, {9, 0}};
+    std::vector<std::pair<int, int>> batch = {{7, 1}, {1, 1}, {3, 1}, {7, 2}, {10, 1}, {0, 1}};
+
+    ASSERT_EQ(my_map.insert_batch(batch), 4);
+    std_map.insert(batch.begin(), batch.end());
+
+    ASSERT_EQ(my_map.size(), std_map.size());
+    auto my_it = my_map.begin();
+    for (const auto& [key, value] : std_map) {
+        ASSERT_EQ((*my_it).first, key);
+        ASSERT_EQ((*my_it).second, value);
+        ++my_it;
+    }
+}
+
+TEST(FlatMapTest, SearchPoliciesTest) {
+    const int N = 1000;
+    std::mt19937 gen(42);
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < N; ++i) {
+        int key = static_cast<int>(gen() % (4 * N));
+        batch.push_back({key, i});
+    }
+
+    FlatMap<int, int> binary_map;
+    FlatMap<int, int, std::less<int>, BranchlessSearch> branchless_map;
+    FlatMap<int, int, std::less<int>, EytzingerSearch<int>> eytzinger_map;
+    std::map<int, int> std_map;
+    binary_map.insert_batch(batch);
+    branchless_map.insert_batch(batch);
+    eytzinger_map.insert_batch(batch);
+    std_map.insert(batch.begin(), batch.end());
+
+    for (int key = -1; key <= 4 * N; ++key) {
+        auto std_it = std_map.find(key);
+        bool found = std_it != std_map.end();
+        ASSERT_EQ(binary_map.contains(key), found);
+        ASSERT_EQ(branchless_map.contains(key), found);
+        ASSERT_EQ(eytzinger_map.contains(key), found);
+        if (found) {
+            ASSERT_EQ(eytzinger_map.at(key), std_it->second);
+        }
+    }
+}
+
+TEST(FlatSetTest, InsertBatchTest) {
+    FlatSet<int> my_set = {4, 2, 8};
+    std::set<int> std_set = {4, 2, 8};
+    std::vector<int> batch = {6, 2, 6, 1, 9, 4, 3};
+
+    ASSERT_EQ(my_set.insert_batch(batch), 4);
+    std_set.insert(batch.begin(), batch.end());
+
+    ASSERT_TRUE(std::equal(
+        my_set.begin(), my_set.end(),
+        std_set.begin(), std_set.end()
+    ));
+}
+
+TEST(FlatSetTest, InsertEraseTest) {
+    FlatSet<int, std::less<int>, EytzingerSearch<int>> my_set;
+    std::set<int> std_set;
+
+    for (int i : {5, 3, 7, 3, 1}) {
+        ASSERT_EQ(my_set.insert(i), std_set.insert(i).second);
+    }
+    ASSERT_TRUE(my_set.erase(3));
+    ASSERT_FALSE(my_set.erase(4));
+    std_set.erase(3);
+
+    ASSERT_TRUE(std::equal(
+        my_set.begin(), my_set.end(),
+        std_set.begin(), std_set.end()
+    ));
+    ASSERT_TRUE(my_set.contains(7));
+    ASSERT_FALSE(my_set.contains(3));
+}
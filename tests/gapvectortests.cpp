@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "lib/gap_vector.hpp"
+
+TEST(GapVectorTest, CursorInsertTest) {
+    GapVector<char> my_gap;
+    std::vector<char> std_vec;
+
+    for (char c : std::string("hello world")) {
+        my_gap.insert(c);
+        std_vec.push_back(c);
+    }
+    my_gap.move_cursor(5);
+    my_gap.insert(',');
+    std_vec.insert(std_vec.begin() + 5, ',');
+
+    ASSERT_EQ(my_gap.cursor(), 6);
+    ASSERT_TRUE(std::equal(
+        my_gap.begin(), my_gap.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(GapVectorTest, EraseTest) {
+    GapVector<int> my_gap = {1, 2, 3, 4, 5, 6};
+    std::vector<int> std_vec = {1, 2, 3, 4, 5, 6};
+
+    my_gap.move_cursor(3);
+    my_gap.erase_before();
+    my_gap.erase_after();
+    std_vec.erase(std_vec.begin() + 2, std_vec.begin() + 4);
+    my_gap.erase(0);
+    std_vec.erase(std_vec.begin());
+
+    ASSERT_EQ(my_gap.size(), std_vec.size());
+    ASSERT_TRUE(std::equal(
+        my_gap.begin(), my_gap.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(GapVectorTest, StressTest) {
+    const int N = 2000;
+    GapVector<std::string> my_gap;
+    std::vector<std::string> std_vec;
+
+    size_t pos = 0;
+    for (int i = 0; i < N; ++i) {
+        pos = (pos * 7 + i) % (std_vec.size() + 1);
+        my_gap.insert(pos, std::to_string(i));
+        std_vec.insert(std_vec.begin() + pos, std::to_string(i));
+        if (i % 5 == 4) {
+            size_t erase_pos = (pos * 3) % std_vec.size();
+            my_gap.erase(erase_pos);
+            std_vec.erase(std_vec.begin() + erase_pos);
+        }
+    }
+
+    ASSERT_EQ(my_gap.size(), std_vec.size());
+    for (size_t i = 0; i < std_vec.size(); ++i) {
+        ASSERT_EQ(my_gap[i], std_vec[i]);
+    }
+}
+
+TEST(GapVectorTest, CompactTest) {
+    GapVector<int> my_gap = {1, 2, 3, 4};
+    std::vector<int> std_vec = {1, 2, 10, 3, 4};
+
+    my_gap.insert(2, 10);
+    Vector<int> compacted = my_gap.compact();
+
+    ASSERT_EQ(compacted.size(), std_vec.size());
+    ASSERT_TRUE(std::equal(
+        compacted.begin(), compacted.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
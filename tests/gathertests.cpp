@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "lib/gather.hpp"
+
+template<typename T, typename Index>
+void CheckGather(size_t src_size, size_t count) {
+    std::mt19937_64 gen(src_size + count);
+    Vector<T> src;
+    src.append_n(src_size, [](size_t i) { return static_cast<T>(i * 3 + 1); });
+    Vector<Index> indices;
+    indices.append_n(count, [&] { return static_cast<Index>(gen() % src_size); });
+
+    Vector<T> out;
+    gather(src, indices, out);
+
+    ASSERT_EQ(out.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(out[i], src[indices[i]]);
+    }
+}
+
+TEST(GatherTest, GatherTest) {
+    CheckGather<int32_t, uint32_t>(1000, 1003);
+    CheckGather<float, int32_t>(1000, 77);
+    CheckGather<double, uint32_t>(5000, 4099);
+    CheckGather<uint64_t, size_t>(5000, 333);
+    CheckGather<int16_t, uint32_t>(100, 100);
+}
+
+TEST(GatherTest, GatherStringTest) {
+    Vector<std::string> src({"a", "b", "c"});
+    Vector<size_t> indices({2, 0, 2, 1});
+    Vector<std::string> out;
+    std::vector<std::string> std_out = {"c", "a", "c", "b"};
+
+    gather(src, indices, out, 1);
+
+    ASSERT_TRUE(std::equal(
+        out.begin(), out.end(),
+        std_out.begin(), std_out.end()
+    ));
+}
+
+TEST(GatherTest, ScatterTest) {
+    const size_t N = 1000;
+    std::mt19937 gen(7);
+    std::vector<uint32_t> std_perm(N);
+    std::iota(std_perm.begin(), std_perm.end(), 0);
+    std::shuffle(std_perm.begin(), std_perm.end(), gen);
+
+    Vector<uint32_t> perm;
+    perm.append_range(std_perm);
+    Vector<int> src;
+    src.append_n(N, [](size_t i) { return static_cast<int>(i); });
+    Vector<int> dst(N, -1);
+
+    scatter(src, perm, dst);
+
+    for (size_t i = 0; i < N; ++i) {
+        ASSERT_EQ(dst[perm[i]], src[i]);
+    }
+
+    Vector<int> short_dst(3, 0);
+    ASSERT_THROW(scatter(Vector<int>({1, 2, 3}), Vector<size_t>({0, 1}), short_dst), std::invalid_argument);
+}
+
+TEST(GatherTest, ApplyPermutationTest) {
+    const size_t N = 1000;
+    std::mt19937 gen(8);
+    std::vector<size_t> std_perm(N);
+    std::iota(std_perm.begin(), std_perm.end(), 0);
+    std::shuffle(std_perm.begin(), std_perm.end(), gen);
+
+    Vector<size_t> perm;
+    perm.append_range(std_perm);
+    Vector<std::string> my_vec;
+    std::vector<std::string> std_vec;
+    for (size_t i = 0; i < N; ++i) {
+        my_vec.push_back(std::to_string(i));
+        std_vec.push_back(std::to_string(std_perm[i]));
+    }
+
+    apply_permutation(my_vec, perm);
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+    ASSERT_THROW(apply_permutation(my_vec, Vector<size_t>({0})), std::invalid_argument);
+
+    Vector<int> pair({10, 20});
+    ASSERT_THROW(apply_permutation(pair, Vector<size_t>({1, 1})), std::invalid_argument);
+    ASSERT_THROW(apply_permutation(pair, Vector<size_t>({0, 2})), std::invalid_argument);
+    ASSERT_EQ(pair[0], 10);
+    ASSERT_EQ(pair[1], 20);
+}
+
+TEST(GatherTest, ApplyPermutationScratchTest) {
+    const size_t N = 1000;
+    std::mt19937 gen(9);
+    std::vector<uint32_t> std_perm(N);
+    std::iota(std_perm.begin(), std_perm.end(), 0);
+    std::shuffle(std_perm.begin(), std_perm.end(), gen);
+
+    Vector<uint32_t> perm;
+    perm.append_range(std_perm);
+    Vector<double> my_vec;
+    my_vec.append_n(N, [](size_t i) { return i * 0.5; });
+    Vector<double> scratch;
+    std::vector<double> std_vec;
+    for (size_t i = 0; i < N; ++i) {
+        std_vec.push_back(std_perm[i] * 0.5);
+    }
+
+    apply_permutation(my_vec, perm, scratch);
+
+    Vector<double> pair({1.0, 2.0});
+    ASSERT_THROW(apply_permutation(pair, Vector<uint32_t>({0, 5}), scratch), std::invalid_argument);
+    ASSERT_THROW(apply_permutation(pair, Vector<uint32_t>({1, 1}), scratch), std::invalid_argument);
+    ASSERT_THROW(apply_permutation(pair, Vector<uint32_t>({0}), scratch), std::invalid_argument);
+    ASSERT_EQ(pair[0], 1.0);
+    ASSERT_EQ(pair[1], 2.0);
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "lib/parallel.hpp"
+#include "lib/vector.hpp"
+
+TEST(ParallelTest, ConstructorTest) {
+    const size_t N = 100000;
+    ParallelPolicy policy{.threads = 4, .min_chunk = 1000};
+    Vector<double> my_vec(N, 1.5, policy);
+    std::vector<double> std_vec(N, 1.5);
+
+    ASSERT_EQ(my_vec.size(), N);
+    ASSERT_EQ(my_vec.capacity(), N);
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ParallelTest, ResizeTest) {
+    ParallelPolicy policy{.threads = 3, .min_chunk = 10};
+    Vector<int> my_vec({1, 2, 3});
+    std::vector<int> std_vec({1, 2, 3});
+
+    my_vec.resize(10000, 7, policy);
+    std_vec.resize(10000, 7);
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+
+    my_vec.resize(2, 0, policy);
+    std_vec.resize(2, 0);
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ParallelTest, AssignFillTest) {
+    ParallelPolicy policy{.threads = 4, .min_chunk = 100, .pin_threads = true};
+    Vector<int> my_vec;
+    std::vector<int> std_vec;
+
+    my_vec.assign(50000, 3, policy);
+    std_vec.assign(50000, 3);
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+
+    my_vec.fill(9, policy);
+    std::fill(std_vec.begin(), std_vec.end(), 9);
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(ParallelTest, SerialFallbackTest) {
+    ParallelPolicy policy{.threads = 4, .min_chunk = 1};
+    Vector<std::string> my_vec(100, "x", policy);
+    std::vector<std::string> std_vec(100, "x");
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+struct ThrowingAssign {
+    int value = 0;
+
+    ThrowingAssign() = default;
+    ThrowingAssign(int v) : value(v) {}
+    ThrowingAssign(const ThrowingAssign&) = default;
+
+    ThrowingAssign& operator=(const ThrowingAssign& other) {
+        if (other.value < 0) {
+            throw std::runtime_error("negative");
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+TEST(ParallelTest, ThrowingFillTest) {
+    ParallelPolicy policy{.threads = 4, .min_chunk = 1};
+    Vector<ThrowingAssign> my_vec(10000, ThrowingAssign(1));
+
+    ASSERT_THROW(my_vec.fill(ThrowingAssign(-1), policy), std::runtime_error);
+
+    my_vec.fill(ThrowingAssign(5), policy);
+    for (size_t i = 0; i < my_vec.size(); ++i) {
+        ASSERT_EQ(my_vec[i].value, 5);
+    }
+}
+
+TEST(ParallelTest, PageChunkTest) {
+    struct Triple {
+        uint64_t a, b, c;
+    };
+    ParallelPolicy policy{.threads = 5, .min_chunk = 1};
+    std::vector<Triple> data(10007);
+    std::vector<int> hits(data.size(), 0);
+    std::vector<std::pair<size_t, size_t>> chunks;
+    std::mutex mutex;
+
+    parallel_for_pages(data.data(), 3, data.size(), policy, [&](size_t first, size_t last) {
+        std::lock_guard lock(mutex);
+        chunks.emplace_back(first, last);
+        for (size_t i = first; i < last; ++i) {
+            hits[i]++;
+        }
+    });
+
+    ASSERT_TRUE(std::all_of(hits.begin() + 3, hits.end(), [](int hit) { return hit == 1; }));
+    ASSERT_GT(chunks.size(), 1);
+    for (const auto& [first, last] : chunks) {
+        if (first == 3 || first == last) {
+            continue;
+        }
+        auto page = [&](size_t i) { return reinterpret_cast<uintptr_t>(data.data() + i) / parallel_page_bytes; };
+        ASSERT_NE(page(first - 1), page(first));
+    }
+}
+
+TEST(ParallelTest, ChunkCoverageTest) {
+    ParallelPolicy policy{.threads = 7, .min_chunk = 1};
+    std::vector<int> hits(1003, 0);
+
+    parallel_for<16>(hits.size(), policy, [&](size_t first, size_t last) {
+        ASSERT_EQ(first % 16, 0);
+        for (size_t i = first; i < last; ++i) {
+            hits[i]++;
+        }
+    });
+
+    ASSERT_TRUE(std::all_of(hits.begin(), hits.end(), [](int hit) { return hit == 1; }));
+}
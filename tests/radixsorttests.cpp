@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "lib/radix_sort.hpp"
+
+template<typename T, typename Gen>
+void CheckRadixSort(size_t count, Gen gen) {
+    Vector<T> my_vec;
+    std::vector<T> std_vec;
+    for (size_t i = 0; i < count; ++i) {
+        T value = gen();
+        my_vec.push_back(value);
+        std_vec.push_back(value);
+    }
+
+    radix_sort(my_vec);
+    std::sort(std_vec.begin(), std_vec.end());
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(RadixSortTest, UnsignedTest) {
+    std::mt19937_64 gen(1);
+    CheckRadixSort<uint64_t>(10000, [&] { return gen(); });
+    CheckRadixSort<uint32_t>(10000, [&] { return static_cast<uint32_t>(gen() % 1000); });
+    CheckRadixSort<uint8_t>(1000, [&] { return static_cast<uint8_t>(gen()); });
+}
+
+TEST(RadixSortTest, SignedTest) {
+    std::mt19937_64 gen(2);
+    CheckRadixSort<int64_t>(10000, [&] { return static_cast<int64_t>(gen()); });
+    CheckRadixSort<int32_t>(10000, [&] { return static_cast<int32_t>(gen() % 2001) - 1000; });
+    CheckRadixSort<int16_t>(100, [&] { return static_cast<int16_t>(gen()); });
+}
+
+TEST(RadixSortTest, FloatingPointTest) {
+    std::mt19937_64 gen(3);
+    std::uniform_real_distribution<float> floats(-1e6f, 1e6f);
+    std::uniform_real_distribution<double> doubles(-1.0, 1.0);
+    CheckRadixSort<float>(10000, [&] { return floats(gen); });
+    CheckRadixSort<double>(10000, [&] { return doubles(gen) * std::pow(10.0, gen() % 40); });
+
+    Vector<double> my_vec;
+    for (double d : {0.0, -1.5, 3.25, -0.0, -1e300, 1e300, 2.0}) {
+        my_vec.append_n(100, [d] { return d; });
+    }
+    radix_sort(my_vec);
+    ASSERT_TRUE(std::is_sorted(my_vec.data(), my_vec.data() + my_vec.size()));
+}
+
+TEST(RadixSortTest, ScratchReuseTest) {
+    std::mt19937 gen(4);
+    Vector<uint32_t> scratch;
+    for (int round = 0; round < 3; ++round) {
+        Vector<uint32_t> my_vec;
+        my_vec.append_n(5000, [&] { return static_cast<uint32_t>(gen()); });
+        radix_sort(my_vec, scratch);
+        ASSERT_EQ(my_vec.size(), 5000);
+        ASSERT_EQ(scratch.size(), 5000);
+        ASSERT_TRUE(std::is_sorted(my_vec.data(), my_vec.data() + my_vec.size()));
+    }
+}
+
+TEST(RadixSortTest, ByKeyTest) {
+    std::mt19937 gen(5);
+    for (size_t count : {size_t(50), size_t(5000)}) {
+        Vector<int32_t> keys;
+        Vector<std::string> values;
+        std::vector<std::pair<int32_t, std::string>> std_pairs;
+        for (size_t i = 0; i < count; ++i) {
+            int32_t key = static_cast<int32_t>(gen() % 100) - 50;
+            keys.push_back(key);
+            values.push_back(std::to_string(i));
+            std_pairs.push_back({key, std::to_string(i)});
+        }
+
+        radix_sort_by_key(keys, values);
+        std::stable_sort(std_pairs.begin(), std_pairs.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(keys[i], std_pairs[i].first);
+            ASSERT_EQ(values[i], std_pairs[i].second);
+        }
+    }
+}
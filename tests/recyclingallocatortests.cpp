@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "lib/vector.hpp"
+#include "lib/recycling_allocator.hpp"
+
+template<typename T>
+using RecyclingVector = Vector<T, RecyclingAllocator<T>>;
+
+TEST(RecyclingAllocatorTest, ReuseTest) {
+    RecyclingPool& pool = RecyclingPool::local();
+    pool.trim();
+    pool.reset_stats();
+
+    for (int round = 0; round < 10; round++) {
+        RecyclingVector<int> my_vec;
+        my_vec.reserve(1000);
+        for (int i = 0; i < 1000; i++) {
+            my_vec.push_back(i);
+        }
+        ASSERT_EQ(my_vec[999], 999);
+    }
+
+    ASSERT_EQ(pool.stats().misses, 1);
+    ASSERT_EQ(pool.stats().hits, 9);
+    ASSERT_EQ(pool.stats().recycled, 10);
+}
+
+TEST(RecyclingAllocatorTest, ShrinkTest) {
+    RecyclingPool& pool = RecyclingPool::local();
+    pool.trim();
+    pool.reset_stats();
+
+    RecyclingVector<std::string> my_vec;
+    std::vector<std::string> std_vec;
+    for (int i = 0; i < 100; i++) {
+        my_vec.push_back(std::to_string(i));
+        std_vec.push_back(std::to_string(i));
+    }
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+
+    size_t cached = pool.stats().cached_bytes;
+    my_vec.clear();
+    my_vec.shrink_to_fit();
+
+    ASSERT_EQ(my_vec.capacity(), 0);
+    ASSERT_GT(pool.stats().cached_bytes, cached);
+}
+
+TEST(RecyclingAllocatorTest, BoundedCacheTest) {
+    RecyclingPool& pool = RecyclingPool::local();
+    pool.trim();
+    pool.reset_stats();
+    size_t limit = pool.max_cached_bytes();
+    pool.set_max_cached_bytes(4096);
+
+    {
+        RecyclingVector<char> small;
+        small.reserve(1024);
+        RecyclingVector<char> large;
+        large.reserve(8192);
+    }
+
+    ASSERT_EQ(pool.stats().recycled, 1);
+    ASSERT_EQ(pool.stats().evicted, 1);
+    ASSERT_LE(pool.stats().cached_bytes, 4096);
+    pool.set_max_cached_bytes(limit);
+}
+
+TEST(RecyclingAllocatorTest, ThreadLocalTest) {
+    RecyclingPool::local().trim();
+    RecyclingPool::local().reset_stats();
+
+    std::thread worker([] {
+        RecyclingVector<int> my_vec(100, 1);
+        ASSERT_EQ(RecyclingPool::local().stats().hits, 0);
+    });
+    worker.join();
+
+    ASSERT_EQ(RecyclingPool::local().stats().misses, 0);
+}
+
+TEST(RecyclingAllocatorTest, ThreadLocalVectorTeardownTest) {
+    std::atomic<bool> pool_destroyed = false;
+
+    std::thread worker([&pool_destroyed] {
+        struct Holder {
+            RecyclingVector<int> vec;
+            std::atomic<bool>* pool_destroyed;
+
+            ~Holder() {
+                pool_destroyed->store(RecyclingPool::local_destroyed());
+            }
+        };
+        thread_local Holder holder{{}, &pool_destroyed};
+        for (int i = 0; i < 1000; i++) {
+            holder.vec.push_back(i);
+        }
+        ASSERT_EQ(holder.vec[999], 999);
+    });
+    worker.join();
+
+    ASSERT_TRUE(pool_destroyed.load());
+}
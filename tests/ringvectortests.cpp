@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <string>
+#include <algorithm>
+#include "lib/ring_vector.hpp"
+
+TEST(RingVectorTest, PushPopTest) {
+    RingVector<int> my_ring;
+    std::deque<int> std_deque;
+
+    for (int i = 0; i < 100; i++) {
+        if (i % 3 == 0) {
+            my_ring.push_front(i);
+            std_deque.push_front(i);
+        } else {
+            my_ring.push_back(i);
+            std_deque.push_back(i);
+        }
+        if (i % 7 == 6) {
+            my_ring.pop_front();
+            std_deque.pop_front();
+        }
+        if (i % 11 == 10) {
+            my_ring.pop_back();
+            std_deque.pop_back();
+        }
+    }
+
+    ASSERT_EQ(my_ring.size(), std_deque.size());
+    ASSERT_TRUE(std::equal(
+        my_ring.begin(), my_ring.end(),
+        std_deque.begin(), std_deque.end()
+    ));
+    ASSERT_EQ(my_ring.front(), std_deque.front());
+    ASSERT_EQ(my_ring.back(), std_deque.back());
+}
+
+TEST(RingVectorTest, QueueTest) {
+    RingVector<std::string> my_ring;
+    std::deque<std::string> std_deque;
+
+    for (int i = 0; i < 1000; i++) {
+        my_ring.push_back(std::to_string(i));
+        std_deque.push_back(std::to_string(i));
+        if (i % 2 == 0) {
+            my_ring.pop_front();
+            std_deque.pop_front();
+        }
+    }
+
+    ASSERT_TRUE(std::equal(
+        my_ring.begin(), my_ring.end(),
+        std_deque.begin(), std_deque.end()
+    ));
+    ASSERT_EQ(my_ring.capacity(), 512);
+}
+
+TEST(RingVectorTest, SpansTest) {
+    RingVector<int> my_ring;
+    my_ring.reserve(8);
+    for (int i = 0; i < 6; i++) {
+        my_ring.push_back(i);
+    }
+    for (int i = 0; i < 4; i++) {
+        my_ring.pop_front();
+    }
+    for (int i = 6; i < 10; i++) {
+        my_ring.push_back(i);
+    }
+
+    auto [first, second] = my_ring.as_spans();
+    std::deque<int> joined(first.begin(), first.end());
+    joined.insert(joined.end(), second.begin(), second.end());
+
+    ASSERT_EQ(first.size(), 4);
+    ASSERT_EQ(second.size(), 2);
+    ASSERT_TRUE(std::equal(
+        my_ring.begin(), my_ring.end(),
+        joined.begin(), joined.end()
+    ));
+}
+
+TEST(RingVectorTest, GrowUnwrapTest) {
+    RingVector<int> my_ring = {1, 2, 3, 4};
+    std::deque<int> std_deque = {1, 2, 3, 4};
+
+    my_ring.pop_front();
+    my_ring.push_back(5);
+    my_ring.push_back(6);
+    std_deque.pop_front();
+    std_deque.push_back(5);
+    std_deque.push_back(6);
+
+    auto [first, second] = my_ring.as_spans();
+    ASSERT_EQ(first.size(), my_ring.size());
+    ASSERT_TRUE(second.empty());
+    ASSERT_TRUE(std::equal(
+        my_ring.begin(), my_ring.end(),
+        std_deque.begin(), std_deque.end()
+    ));
+}
+
+TEST(RingVectorTest, STLAlgorithms) {
+    RingVector<int> my_ring;
+    std::deque<int> std_deque;
+    for (int i : {5, 3, 1, 4, 2}) {
+        my_ring.push_front(i);
+        std_deque.push_front(i);
+    }
+
+    std::sort(my_ring.begin(), my_ring.end());
+    std::sort(std_deque.begin(), std_deque.end());
+
+    ASSERT_TRUE(std::equal(
+        my_ring.begin(), my_ring.end(),
+        std_deque.begin(), std_deque.end()
+    ));
+    ASSERT_EQ(*my_ring.rbegin(), *std_deque.rbegin());
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include "lib/shared_vector.hpp"
+
+TEST(SharedVectorTest, SnapshotTest) {
+    SharedVector<int> shared(Vector<int>({1, 2, 3}));
+    std::vector<int> std_vec = {1, 2, 3};
+
+    auto snap = shared.snapshot();
+
+    ASSERT_TRUE(std::equal(
+        snap->begin(), snap->end(),
+        std_vec.begin(), std_vec.end()
+    ));
+    ASSERT_EQ(shared.version(), 0);
+}
+
+TEST(SharedVectorTest, PublishTest) {
+    SharedVector<int> shared(Vector<int>({1, 2, 3}));
+    std::vector<int> std_vec = {1, 2, 3, 4};
+
+    auto old_snap = shared.snapshot();
+    shared.edit().push_back(4);
+
+    ASSERT_EQ(shared.snapshot(), old_snap);
+    ASSERT_TRUE(shared.publish());
+
+    auto new_snap = shared.snapshot();
+    ASSERT_TRUE(std::equal(
+        new_snap->begin(), new_snap->end(),
+        std_vec.begin(), std_vec.end()
+    ));
+    ASSERT_EQ(old_snap->size(), 3);
+    ASSERT_EQ(shared.version(), 1);
+}
+
+TEST(SharedVectorTest, CopyOnWriteTest) {
+    SharedVector<int> shared(Vector<int>({1, 2, 3}));
+
+    auto snap = shared.snapshot();
+
+    ASSERT_FALSE(shared.dirty());
+    ASSERT_FALSE(shared.publish());
+    ASSERT_EQ(shared.snapshot(), snap);
+    ASSERT_EQ(shared.version(), 0);
+
+    shared.edit()[0] = 10;
+    shared.discard();
+
+    ASSERT_FALSE(shared.publish());
+    ASSERT_EQ(shared.snapshot()->front(), 1);
+}
+
+TEST(SharedVectorTest, ReclamationTest) {
+    SharedVector<int> shared(Vector<int>({1, 2, 3}));
+
+    auto snap = shared.snapshot();
+    std::weak_ptr<const Vector<int>> weak = snap;
+
+    shared.update([](Vector<int>& vec) { vec.push_back(4); });
+
+    ASSERT_FALSE(weak.expired());
+    snap.reset();
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(SharedVectorTest, ConcurrentReadersTest) {
+    const int N = 1000;
+    SharedVector<int> shared;
+    std::vector<std::thread> readers;
+    std::atomic<bool> consistent = true;
+
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            for (int i = 0; i < N; ++i) {
+                auto snap = shared.snapshot();
+                for (size_t j = 0; j < snap->size(); ++j) {
+                    if ((*snap)[j] != static_cast<int>(j)) {
+                        consistent = false;
+                    }
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < N; ++i) {
+        shared.update([i](Vector<int>& vec) { vec.push_back(i); });
+    }
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(shared.snapshot()->size(), N);
+}
+
+TEST(SharedVectorTest, VersionedSnapshotTest) {
+    SharedVector<size_t> shared(Vector<size_t>({0}));
+    std::atomic<bool> done = false;
+    std::atomic<size_t> mismatches = 0;
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            auto [snap, version] = shared.versioned_snapshot();
+            if (snap->front() != version) {
+                mismatches++;
+            }
+        }
+    });
+    for (size_t i = 1; i <= 1000; i++) {
+        shared.update([i](Vector<size_t>& vec) { vec[0] = i; });
+    }
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(mismatches.load(), 0);
+    ASSERT_EQ(shared.version(), 1000);
+    ASSERT_EQ(shared.versioned_snapshot().first->front(), 1000);
+}
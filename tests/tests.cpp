@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <vector>
+#include <string>
+#include <unordered_set>
+#include <ranges>
 #include "lib/vector.hpp"
 
 TEST(VectorTest, PushBackTest) {
@@ -26,6 +29,21 @@ TEST(VectorTest, PopBackTest) {
     ));
 }
 
+TEST(VectorTest, PopBackStringTest) {
+    Vector<std::string> my_vec;
+    std::vector<std::string> std_vec;
+    for (int i = 0; i < 5; i++) {
+        my_vec.push_back(std::string(32, 'a' + i));
+        std_vec.push_back(std::string(32, 'a' + i));
+    }
+    my_vec.pop_back();
+    std_vec.pop_back();
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
 TEST(VectorTest, MovePushBackTest) {
     Vector<int> my_vec;
     std::vector<int> std_vec;
@@ -172,6 +190,23 @@ TEST(VectorTest, InsertListTest) {
     ));
 }
 
+TEST(VectorTest, InsertConstIteratorTest) {
+    Vector<int> copy ({4, 5});
+    std::vector<int> std_copy ({4, 5});
+    Vector<int> my_vec({1, 2, 3});
+    std::vector<int> std_vec({1, 2, 3});
+
+    my_vec.insert(my_vec.cbegin() + 1, {7, 8});
+    std_vec.insert(std_vec.cbegin() + 1, {7, 8});
+    my_vec.insert(my_vec.cbegin(), copy.begin(), copy.end());
+    std_vec.insert(std_vec.cbegin(), std_copy.begin(), std_copy.end());
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
 TEST(VectorTest, BoarderTest) {
     Vector<int> my_vec;
     std::vector<int> std_vec;
@@ -300,6 +335,57 @@ TEST(VectorTest, AssignListTest) {
     ));
 }
 
+TEST(VectorTest, EqualityTest) {
+    Vector<int> my_vec1({1, 2, 3});
+    Vector<int> my_vec2({1, 2, 3});
+    Vector<int> my_vec3({1, 2, 4});
+    Vector<std::string> my_strs1({"a", "b"});
+    Vector<std::string> my_strs2({"a", "b"});
+
+    ASSERT_TRUE(my_vec1 == my_vec2);
+    ASSERT_TRUE(my_vec1 != my_vec3);
+    ASSERT_TRUE(my_vec1 != Vector<int>({1, 2}));
+    ASSERT_TRUE(Vector<int>() == Vector<int>());
+    ASSERT_TRUE(my_strs1 == my_strs2);
+}
+
+TEST(VectorTest, ThreeWayCompareTest) {
+    std::vector<std::vector<int>> std_vecs = {
+        {}, {1}, {1, 2}, {1, 3}, {-1, 5}, {2}, {1, 2, 0}
+    };
+    for (int i = 0; i < 100; i++) {
+        std_vecs.push_back(std::vector<int>(40 + i % 30, 7));
+        std_vecs.back().push_back(i % 5);
+    }
+
+    for (const auto& lhs : std_vecs) {
+        for (const auto& rhs : std_vecs) {
+            Vector<int> my_lhs;
+            Vector<int> my_rhs;
+            my_lhs.append_range(lhs);
+            my_rhs.append_range(rhs);
+            ASSERT_EQ(my_lhs <=> my_rhs, lhs <=> rhs);
+            ASSERT_EQ(my_lhs == my_rhs, lhs == rhs);
+        }
+    }
+
+    Vector<std::string> my_strs1({"a", "b"});
+    Vector<std::string> my_strs2({"a", "c"});
+    ASSERT_TRUE(my_strs1 < my_strs2);
+}
+
+TEST(VectorTest, HashTest) {
+    std::unordered_set<Vector<int>> my_set;
+    my_set.insert(Vector<int>({1, 2, 3}));
+    my_set.insert(Vector<int>({1, 2, 3}));
+    my_set.insert(Vector<int>({3, 2, 1}));
+
+    ASSERT_EQ(my_set.size(), 2);
+    ASSERT_TRUE(my_set.contains(Vector<int>({3, 2, 1})));
+    ASSERT_EQ(std::hash<Vector<std::string>>{}(Vector<std::string>({"x"})),
+              std::hash<Vector<std::string>>{}(Vector<std::string>({"x"})));
+}
+
 TEST(VectorTest, RangeTest) {
     Vector<int> my_vec;
     std::vector<int> std_vec;
@@ -332,3 +418,69 @@ TEST(VectorTest, RangeTest) {
         std_vec.begin(), std_vec.end()
     ));
 }
+
+TEST(VectorTest, AppendNTest) {
+    Vector<int> my_vec({1, 2});
+    std::vector<int> std_vec({1, 2});
+
+    my_vec.append_n(5, [](size_t i) { return static_cast<int>(i * i); });
+    int counter = 10;
+    my_vec.append_n(3, [&counter] { return counter++; });
+    for (int i = 0; i < 5; i++) {
+        std_vec.push_back(i * i);
+    }
+    for (int i = 10; i < 13; i++) {
+        std_vec.push_back(i);
+    }
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(VectorTest, EmplaceBackNTest) {
+    Vector<std::string> my_vec;
+    std::vector<std::string> std_vec;
+
+    my_vec.emplace_back_n(4, 3, 'x');
+    std_vec.insert(std_vec.end(), 4, std::string(3, 'x'));
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(VectorTest, AppendUnsizedRangeTest) {
+    Vector<int> my_vec({-1});
+    std::vector<int> std_vec({-1});
+
+    auto evens = std::views::iota(0, 1000) | std::views::filter([](int i) { return i % 2 == 0; });
+    my_vec.append_range(evens);
+    for (int i : evens) {
+        std_vec.push_back(i);
+    }
+
+    ASSERT_EQ(my_vec.size(), std_vec.size());
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}
+
+TEST(VectorTest, AppendSizedRangeTest) {
+    Vector<int> my_vec;
+    std::vector<int> std_vec = {4, 5, 6, 7, 8};
+    std::vector<int> v1 = {4, 5};
+    std::vector<int> v2 = {6, 7, 8};
+
+    my_vec.append_range(v1);
+    my_vec.append_range(v2);
+    my_vec.append_range(std::vector<int>{});
+
+    ASSERT_TRUE(std::equal(
+        my_vec.begin(), my_vec.end(),
+        std_vec.begin(), std_vec.end()
+    ));
+}